@@ -0,0 +1,364 @@
+#!/usr/bin/env python3
+"""
+Measures the compile-time cost of the heavier template headers.
+
+For each header, a translation unit is generated that instantiates the
+header's templates at an increasing arity (the number of distinct types
+involved). Each translation unit is compiled several times, and the fastest
+wall and CPU time, along with the peak memory of the compiler, are written
+out as JSON so that results can be compared across releases.
+
+An arity of 0 only includes the header, which records the cost of parsing it.
+
+Clang additionally writes a '-ftime-trace' profile next to each object file,
+and GCC writes its '-ftime-report' output, which are referenced from the
+JSON output for finding where the time is spent.
+
+Only GCC and Clang compatible compiler drivers are supported.
+"""
+
+import argparse
+import datetime
+import json
+import os
+import platform
+import subprocess
+import sys
+import time
+
+try:
+  import resource
+except ImportError: # Windows
+  resource = None
+
+#------------------------------------------------------------------------------
+# Translation Units
+#------------------------------------------------------------------------------
+
+ALTERNATIVE_TEMPLATE = """\
+template <int N>
+struct alternative
+{
+  alternative() = default;
+  alternative(int v) : value{v}{}
+
+  int value;
+};
+
+template <int N>
+bool operator==(const alternative<N>& lhs, const alternative<N>& rhs)
+{
+  return lhs.value == rhs.value;
+}
+
+template <int N>
+bool operator<(const alternative<N>& lhs, const alternative<N>& rhs)
+{
+  return lhs.value < rhs.value;
+}
+"""
+
+def alternatives(arity):
+  """Spells out 'alternative<0>, ..., alternative<arity - 1>'
+
+  The types are spelled out, rather than generated with an index_sequence,
+  so that only the header under test is measured.
+  """
+  return ", ".join("alternative<{}>".format(i) for i in range(arity))
+
+def make_variant_source(arity):
+  if arity == 0:
+    return "#include <bpstd/variant.hpp>\n"
+
+  return """\
+#include <bpstd/variant.hpp>
+
+{alternative}
+using variant_type = bpstd::variant<{types}>;
+
+struct visitor
+{{
+  template <typename T>
+  int operator()(const T& v) const {{ return v.value; }}
+}};
+
+struct binary_visitor
+{{
+  template <typename T, typename U>
+  int operator()(const T& t, const U& u) const {{ return t.value + u.value; }}
+}};
+
+int instantiate(variant_type& v, const variant_type& w)
+{{
+  auto copy = w;
+  v = std::move(copy);
+
+  auto result = bpstd::visit(visitor{{}}, v);
+  result += bpstd::visit(binary_visitor{{}}, v, w);
+  result += bpstd::get<{last}>(v).value;
+  result += bpstd::get_if<alternative<0>>(&v) != nullptr;
+  result += bpstd::holds_alternative<alternative<{last}>>(w);
+  result += (v == w) + (v < w);
+  v.emplace<{last}>(result);
+  return result + static_cast<int>(v.index());
+}}
+""".format(alternative=ALTERNATIVE_TEMPLATE,
+           types=alternatives(arity),
+           last=arity - 1)
+
+def make_tuple_source(arity):
+  if arity == 0:
+    return "#include <bpstd/tuple.hpp>\n"
+
+  return """\
+#include <bpstd/tuple.hpp>
+
+{alternative}
+using tuple_type = bpstd::tuple<{types}>;
+
+struct sum
+{{
+  template <typename...Types>
+  int operator()(const Types&...values) const
+  {{
+    int result = 0;
+    const int unpacked[] = {{values.value...}};
+    for (auto v : unpacked) {{
+      result += v;
+    }}
+    return result;
+  }}
+}};
+
+struct aggregate
+{{
+  template <typename...Types>
+  aggregate(const Types&...values) : value{{sum{{}}(values...)}}{{}}
+
+  int value;
+}};
+
+int instantiate(tuple_type& t)
+{{
+  auto result = bpstd::apply(sum{{}}, t);
+  result += bpstd::make_from_tuple<aggregate>(t).value;
+  result += bpstd::get<alternative<{last}>>(t).value;
+  result += static_cast<int>(bpstd::tuple_size<tuple_type>::value);
+  return result;
+}}
+""".format(alternative=ALTERNATIVE_TEMPLATE,
+           types=alternatives(arity),
+           last=arity - 1)
+
+def make_optional_source(arity):
+  if arity == 0:
+    return "#include <bpstd/optional.hpp>\n"
+
+  calls = "\n".join(
+    "  result += instantiate_one<{}>();".format(i) for i in range(arity)
+  )
+
+  return """\
+#include <bpstd/optional.hpp>
+
+{alternative}
+template <int N>
+struct next
+{{
+  bpstd::optional<alternative<N>> operator()(const alternative<N>& v) const
+  {{
+    return alternative<N>{{v.value + 1}};
+  }}
+}};
+
+template <int N>
+struct unwrap
+{{
+  int operator()(const alternative<N>& v) const {{ return v.value; }}
+}};
+
+template <int N>
+int instantiate_one()
+{{
+  auto o = bpstd::optional<alternative<N>>{{}};
+  auto copy = o;
+  o = alternative<N>{{N}};
+  copy.swap(o);
+
+  auto result = copy.and_then(next<N>{{}}).transform(unwrap<N>{{}}).value_or(0);
+  result += o.value_or(alternative<N>{{0}}).value;
+  result += (o == copy) + (o < copy) + (o == bpstd::nullopt);
+  return result;
+}}
+
+int instantiate()
+{{
+  auto result = 0;
+{calls}
+  return result;
+}}
+""".format(alternative=ALTERNATIVE_TEMPLATE, calls=calls)
+
+SOURCE_GENERATORS = {
+  "variant": make_variant_source,
+  "tuple": make_tuple_source,
+  "optional": make_optional_source,
+}
+
+#------------------------------------------------------------------------------
+# Measurement
+#------------------------------------------------------------------------------
+
+def is_clang(compiler):
+  output = subprocess.run([compiler, "--version"],
+                          stdout=subprocess.PIPE,
+                          stderr=subprocess.STDOUT,
+                          universal_newlines=True).stdout
+  return "clang" in output.lower()
+
+def compile_once(command, log_path):
+  """Compiles once, returning (exit status, wall seconds, cpu seconds,
+  peak kilobytes)
+
+  The CPU time and peak memory are only available on POSIX systems, and are
+  'None' elsewhere.
+  """
+  with open(log_path, "w") as log:
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stdout=log, stderr=log)
+
+    if resource is None:
+      status = process.wait()
+      wall = time.perf_counter() - start
+      cpu = None
+      peak = None
+    else:
+      # wait4 reports the resource usage of this compiler alone, where
+      # RUSAGE_CHILDREN would accumulate across every compilation
+      _, status, usage = os.wait4(process.pid, 0)
+      wall = time.perf_counter() - start
+      process.returncode = os.waitstatus_to_exitcode(status)
+      status = process.returncode
+      cpu = usage.ru_utime + usage.ru_stime
+      # ru_maxrss is in bytes on macOS, and kilobytes everywhere else
+      peak = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+
+  return status, wall, cpu, peak
+
+def measure(args, header, arity, clang):
+  name = "{}_{}".format(header, arity)
+  source_path = os.path.join(args.work_dir, name + ".cpp")
+  object_path = os.path.join(args.work_dir, name + ".o")
+  log_path = os.path.join(args.work_dir, name + ".log")
+
+  with open(source_path, "w") as source:
+    source.write(SOURCE_GENERATORS[header](arity))
+
+  command = [args.compiler, "-std=" + args.standard, "-I", args.include_dir]
+  command += args.flag
+  command += ["-c", source_path, "-o", object_path]
+
+  result = {
+    "name": "{}/{}".format(header, arity),
+    "header": header,
+    "arity": arity,
+  }
+
+  walls, cpus, peaks = [], [], []
+  for _ in range(args.repetitions):
+    status, wall, cpu, peak = compile_once(command, log_path)
+    if status != 0:
+      # Exceeding a compiler limit at a high arity is itself a result worth
+      # tracking, so the failure is recorded rather than aborting the run
+      result["error"] = "exited with status {}".format(status)
+      result["log"] = log_path
+      return result
+    walls.append(wall)
+    cpus.append(cpu)
+    peaks.append(peak)
+
+  result.update({
+    "repetitions": args.repetitions,
+    "wall_time_s": min(walls),
+    "cpu_time_s": None if None in cpus else min(cpus),
+    "max_rss_kb": None if None in peaks else max(peaks),
+    "object_size_bytes": os.path.getsize(object_path),
+  })
+
+  # Profiles are collected in a separate run, so they do not skew the times
+  if clang:
+    compile_once(command[:1] + ["-ftime-trace"] + command[1:], log_path)
+    result["time_trace"] = os.path.splitext(object_path)[0] + ".json"
+  else:
+    compile_once(command[:1] + ["-ftime-report"] + command[1:], log_path)
+    result["time_report"] = log_path
+
+  return result
+
+#------------------------------------------------------------------------------
+# Entry
+#------------------------------------------------------------------------------
+
+def parse_arguments():
+  parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+  parser.add_argument("--compiler", required=True,
+                      help="the C++ compiler to measure")
+  parser.add_argument("--include-dir", required=True,
+                      help="the directory containing 'bpstd/'")
+  parser.add_argument("--work-dir", required=True,
+                      help="the directory for generated sources and objects")
+  parser.add_argument("--output", required=True,
+                      help="the JSON file to write results to")
+  parser.add_argument("--standard", default="c++11",
+                      help="the language standard to compile as")
+  parser.add_argument("--header", action="append",
+                      choices=sorted(SOURCE_GENERATORS.keys()),
+                      help="the headers to measure (default: all)")
+  parser.add_argument("--arity", action="append", type=int,
+                      help="the arities to measure (default: 0, 8, 32, 128)")
+  parser.add_argument("--repetitions", type=int, default=3,
+                      help="the number of times to compile each source")
+  parser.add_argument("--flag", action="append", default=[],
+                      help="an additional flag to pass to the compiler")
+  return parser.parse_args()
+
+def main():
+  args = parse_arguments()
+  headers = args.header or sorted(SOURCE_GENERATORS.keys())
+  arities = args.arity or [0, 8, 32, 128]
+
+  if not os.path.isdir(args.work_dir):
+    os.makedirs(args.work_dir)
+
+  clang = is_clang(args.compiler)
+  benchmarks = []
+  for header in headers:
+    for arity in arities:
+      result = measure(args, header, arity, clang)
+      if "error" in result:
+        sys.stderr.write("{:<16} failed, see {}\n".format(
+          result["name"], result["log"]
+        ))
+      else:
+        sys.stderr.write("{:<16} {:8.3f} s {:>10} KiB\n".format(
+          result["name"], result["wall_time_s"], result["max_rss_kb"]
+        ))
+      benchmarks.append(result)
+
+  report = {
+    "context": {
+      "date": datetime.datetime.now().isoformat(),
+      "host_name": platform.node(),
+      "compiler": args.compiler,
+      "standard": args.standard,
+      "flags": args.flag,
+    },
+    "benchmarks": benchmarks,
+  }
+  with open(args.output, "w") as output:
+    json.dump(report, output, indent=2)
+
+  return 0
+
+if __name__ == "__main__":
+  sys.exit(main())
@@ -0,0 +1,128 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/aho_corasick.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int64_t
+#include <random>   // std::mt19937
+#include <string>   // std::string
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+namespace {
+
+  constexpr auto payload_count = std::size_t{64u};
+  constexpr auto payload_size = std::size_t{4096u};
+
+  /// \brief Makes a random string of \p size lower-case letters
+  std::string make_word(std::mt19937& engine, std::size_t size)
+  {
+    auto result = std::string{};
+    for (auto i = std::size_t{0u}; i < size; ++i) {
+      result += static_cast<char>('a' + engine() % 26u);
+    }
+    return result;
+  }
+
+  /// \brief Makes \p count keywords of 4 to 11 letters
+  std::vector<std::string> make_keywords(std::size_t count)
+  {
+    auto engine = std::mt19937{42u};
+    auto result = std::vector<std::string>{};
+    for (auto i = std::size_t{0u}; i < count; ++i) {
+      result.push_back(make_word(engine, 4u + engine() % 8u));
+    }
+    return result;
+  }
+
+  /// \brief Makes payloads of random words, with a keyword every so often
+  std::vector<std::string> make_payloads(const std::vector<std::string>& keywords)
+  {
+    auto engine = std::mt19937{7u};
+    auto result = std::vector<std::string>{};
+    for (auto i = std::size_t{0u}; i < payload_count; ++i) {
+      auto payload = std::string{};
+      while (payload.size() < payload_size) {
+        if (engine() % 16u == 0u) {
+          payload += keywords[engine() % keywords.size()];
+        } else {
+          payload += make_word(engine, 1u + engine() % 8u);
+        }
+        payload += ' ';
+      }
+      payload.resize(payload_size);
+      result.push_back(std::move(payload));
+    }
+    return result;
+  }
+
+  /// \brief Counts the keywords in each payload with one find per keyword
+  void string_view_find_each(benchmark::State& state)
+  {
+    const auto keywords = make_keywords(static_cast<std::size_t>(state.range(0)));
+    const auto payloads = make_payloads(keywords);
+
+    for (auto _ : state) {
+      auto total = std::size_t{0u};
+      for (const auto& payload : payloads) {
+        const auto view = bpstd::string_view{payload};
+        for (const auto& keyword : keywords) {
+          for (auto pos = view.find(keyword); pos != bpstd::string_view::npos;
+               pos = view.find(keyword, pos + 1u)) {
+            ++total;
+          }
+        }
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * payload_count * payload_size));
+  }
+
+  /// \brief Counts the keywords in each payload in a single pass
+  void aho_corasick_find_all(benchmark::State& state)
+  {
+    const auto keywords = make_keywords(static_cast<std::size_t>(state.range(0)));
+    const auto payloads = make_payloads(keywords);
+    const auto matcher = bpstd::aho_corasick{keywords.begin(), keywords.end()};
+
+    for (auto _ : state) {
+      auto total = std::size_t{0u};
+      for (const auto& payload : payloads) {
+        matcher.find_all(payload, [&](bpstd::aho_corasick::match) {
+          ++total;
+        });
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * payload_count * payload_size));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(string_view_find_each)->Arg(16)->Arg(300);
+BENCHMARK(aho_corasick_find_all)->Arg(16)->Arg(300);
@@ -0,0 +1,274 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/any.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <memory>  // std::allocator_arg
+#include <new>     // ::operator new
+#include <utility> // std::move
+#include <vector>  // std::vector
+
+#if __cplusplus >= 201703L
+# include <any> // std::any
+#endif
+
+namespace {
+
+  // 'any_cast' is called with explicit template arguments, which only finds
+  // the overload for each 'any' by argument-dependent lookup when some
+  // 'any_cast' template is already visible
+  using bpstd::any_cast;
+#if __cplusplus >= 201703L
+  using std::any_cast;
+#endif
+
+  /// \brief A value that fits in the small buffer of every 'any'
+  struct small_value
+  {
+    int value;
+  };
+
+  /// \brief A value that is too large for the small buffer of 'any', but
+  ///        fits within 'basic_any<64,16>'
+  ///
+  /// Heap allocations of this value are counted, so that each benchmark can
+  /// report how many allocations it performs per iteration
+  struct large_value
+  {
+    static thread_local std::int64_t allocations;
+
+    static void* operator new(std::size_t size)
+    {
+      ++allocations;
+      return ::operator new(size);
+    }
+    static void operator delete(void* p) noexcept
+    {
+      ::operator delete(p);
+    }
+
+    int value;
+    char padding[56];
+  };
+
+  thread_local std::int64_t large_value::allocations = 0;
+
+  /// \brief An 'any' whose small buffer is large enough for 'large_value'
+  using large_any = bpstd::basic_any<64u, 16u>;
+
+  /// \brief A move-only value that fits in the small buffer
+  struct move_only_value
+  {
+    move_only_value(int v) : value{v}{}
+    move_only_value(move_only_value&&) = default;
+    move_only_value& operator=(move_only_value&&) = default;
+
+    int value;
+  };
+
+  /// \brief An allocator that recycles blocks through a per-thread free
+  ///        list, so that threads never contend on the global heap
+  template <typename T>
+  struct thread_pool_allocator
+  {
+    using value_type = T;
+
+    thread_pool_allocator() = default;
+    template <typename U>
+    thread_pool_allocator(const thread_pool_allocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+      auto& blocks = free_list();
+      if (n == 1u && !blocks.empty()) {
+        auto* p = blocks.back();
+        blocks.pop_back();
+        return static_cast<T*>(p);
+      }
+      return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+      if (n == 1u) {
+        free_list().push_back(p);
+        return;
+      }
+      ::operator delete(p);
+    }
+
+    static std::vector<void*>& free_list()
+    {
+      // Blocks are intentionally leaked at thread exit; the benchmark only
+      // needs a handful of them
+      static thread_local std::vector<void*> s_blocks;
+      return s_blocks;
+    }
+
+    template <typename U>
+    bool operator==(const thread_pool_allocator<U>&) const noexcept { return true; }
+    template <typename U>
+    bool operator!=(const thread_pool_allocator<U>&) const noexcept { return false; }
+  };
+
+  //----------------------------------------------------------------------------
+
+  /// \brief Reports the number of 'large_value' allocations per iteration
+  ///        made since \p first was recorded
+  void report_allocations(benchmark::State& state, std::int64_t first)
+  {
+    state.counters["allocs"] = benchmark::Counter(
+      static_cast<double>(large_value::allocations - first),
+      benchmark::Counter::kAvgIterations
+    );
+  }
+
+  template <typename Any, typename T>
+  void any_construct(benchmark::State& state)
+  {
+    const auto first = large_value::allocations;
+
+    for (auto _ : state) {
+      auto a = Any{T{42}};
+      benchmark::DoNotOptimize(a);
+    }
+    report_allocations(state, first);
+  }
+
+  template <typename Any, typename T>
+  void any_copy(benchmark::State& state)
+  {
+    const auto a = Any{T{42}};
+
+    const auto first = large_value::allocations;
+
+    for (auto _ : state) {
+      auto copy = a;
+      benchmark::DoNotOptimize(copy);
+    }
+    report_allocations(state, first);
+  }
+
+  template <typename Any, typename T>
+  void any_move(benchmark::State& state)
+  {
+    auto a = Any{T{42}};
+
+    const auto first = large_value::allocations;
+
+    for (auto _ : state) {
+      auto moved = std::move(a);
+      benchmark::DoNotOptimize(moved);
+      a = std::move(moved);
+    }
+    report_allocations(state, first);
+  }
+
+  template <typename Any, typename T>
+  void any_cast_value(benchmark::State& state)
+  {
+    auto a = Any{T{42}};
+
+    const auto first = large_value::allocations;
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(a);
+      benchmark::DoNotOptimize(any_cast<T>(&a)->value);
+    }
+    report_allocations(state, first);
+  }
+
+  template <typename Any, typename T>
+  void any_cast_mismatch(benchmark::State& state)
+  {
+    auto a = Any{T{42}};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(a);
+      benchmark::DoNotOptimize(any_cast<double>(&a));
+    }
+  }
+
+  // Constructs and destroys an allocated value on every thread, either
+  // through the global heap or through a per-thread pool
+  template <typename T>
+  void any_construct_heap(benchmark::State& state)
+  {
+    for (auto _ : state) {
+      auto a = bpstd::any{T{42}};
+      benchmark::DoNotOptimize(a);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+  }
+
+  template <typename T>
+  void any_construct_allocator(benchmark::State& state)
+  {
+    const auto alloc = thread_pool_allocator<T>{};
+
+    for (auto _ : state) {
+      auto a = bpstd::any{std::allocator_arg, alloc, T{42}};
+      benchmark::DoNotOptimize(a);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(any_construct, bpstd::any, small_value);
+BENCHMARK_TEMPLATE(any_construct, bpstd::any, large_value);
+BENCHMARK_TEMPLATE(any_construct, large_any, large_value);
+BENCHMARK_TEMPLATE(any_construct, bpstd::unique_any, move_only_value);
+BENCHMARK_TEMPLATE(any_copy, bpstd::any, small_value);
+BENCHMARK_TEMPLATE(any_copy, bpstd::any, large_value);
+BENCHMARK_TEMPLATE(any_copy, large_any, large_value);
+BENCHMARK_TEMPLATE(any_move, bpstd::any, small_value);
+BENCHMARK_TEMPLATE(any_move, bpstd::any, large_value);
+BENCHMARK_TEMPLATE(any_move, large_any, large_value);
+BENCHMARK_TEMPLATE(any_move, bpstd::unique_any, move_only_value);
+BENCHMARK_TEMPLATE(any_cast_value, bpstd::any, small_value);
+BENCHMARK_TEMPLATE(any_cast_value, bpstd::any, large_value);
+BENCHMARK_TEMPLATE(any_cast_value, large_any, large_value);
+BENCHMARK_TEMPLATE(any_cast_value, bpstd::unique_any, move_only_value);
+BENCHMARK_TEMPLATE(any_cast_mismatch, bpstd::any, small_value);
+
+BENCHMARK_TEMPLATE(any_construct_heap, large_value)->ThreadRange(1, 8);
+BENCHMARK_TEMPLATE(any_construct_allocator, large_value)->ThreadRange(1, 8);
+
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(any_construct, std::any, small_value);
+BENCHMARK_TEMPLATE(any_construct, std::any, large_value);
+BENCHMARK_TEMPLATE(any_copy, std::any, small_value);
+BENCHMARK_TEMPLATE(any_copy, std::any, large_value);
+BENCHMARK_TEMPLATE(any_move, std::any, small_value);
+BENCHMARK_TEMPLATE(any_move, std::any, large_value);
+BENCHMARK_TEMPLATE(any_cast_value, std::any, small_value);
+BENCHMARK_TEMPLATE(any_cast_value, std::any, large_value);
+BENCHMARK_TEMPLATE(any_cast_mismatch, std::any, small_value);
+#endif
@@ -0,0 +1,197 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/charconv.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int64_t, std::uint64_t
+#include <cstdio>   // std::snprintf
+#include <cstdlib>  // std::strtod, std::strtoull
+#include <random>   // std::mt19937_64
+#include <string>   // std::string
+#include <vector>   // std::vector
+
+namespace {
+
+  /// \brief Makes \p count random doubles spread over many magnitudes
+  std::vector<double> make_doubles(std::size_t count)
+  {
+    auto engine = std::mt19937_64{42u};
+    auto mantissa = std::uniform_real_distribution<double>{1.0, 10.0};
+    auto exponent = std::uniform_int_distribution<int>{-30, 30};
+
+    auto result = std::vector<double>{};
+    for (auto i = std::size_t{0u}; i < count; ++i) {
+      auto value = mantissa(engine);
+      for (auto e = exponent(engine); e != 0; e += (e > 0) ? -1 : 1) {
+        value = (e > 0) ? value * 10.0 : value / 10.0;
+      }
+      result.push_back(value);
+    }
+    return result;
+  }
+
+  /// \brief Formats \p values as shortest round-trip strings
+  std::vector<std::string> make_double_strings(const std::vector<double>& values)
+  {
+    auto result = std::vector<std::string>{};
+    for (auto v : values) {
+      char buffer[32];
+      const auto r = bpstd::to_chars(buffer, buffer + sizeof(buffer), v);
+      result.emplace_back(buffer, r.ptr);
+    }
+    return result;
+  }
+
+  /// \brief Makes \p count random integers of varying lengths
+  std::vector<std::string> make_integer_strings(std::size_t count)
+  {
+    auto engine = std::mt19937_64{42u};
+    auto result = std::vector<std::string>{};
+    for (auto i = std::size_t{0u}; i < count; ++i) {
+      const auto value = engine() >> (engine() % 64u);
+      result.push_back(std::to_string(value));
+    }
+    return result;
+  }
+
+  constexpr auto value_count = std::size_t{1024u};
+
+  //----------------------------------------------------------------------------
+  // Parsing
+  //----------------------------------------------------------------------------
+
+  /// \brief Parses fields the way it is done without from_chars: by copying
+  ///        each view into a null-terminated string for strtod
+  void strtod_parse_double(benchmark::State& state)
+  {
+    const auto strings = make_double_strings(make_doubles(value_count));
+    const auto views = std::vector<bpstd::string_view>{strings.begin(), strings.end()};
+
+    for (auto _ : state) {
+      auto total = 0.0;
+      for (auto view : views) {
+        const auto copy = std::string{view.data(), view.size()};
+        total += std::strtod(copy.c_str(), nullptr);
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+  }
+
+  void bpstd_from_chars_double(benchmark::State& state)
+  {
+    const auto strings = make_double_strings(make_doubles(value_count));
+    const auto views = std::vector<bpstd::string_view>{strings.begin(), strings.end()};
+
+    for (auto _ : state) {
+      auto total = 0.0;
+      for (auto view : views) {
+        auto value = 0.0;
+        bpstd::from_chars(view, value);
+        total += value;
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+  }
+
+  void strtoull_parse_integer(benchmark::State& state)
+  {
+    const auto strings = make_integer_strings(value_count);
+    const auto views = std::vector<bpstd::string_view>{strings.begin(), strings.end()};
+
+    for (auto _ : state) {
+      auto total = std::uint64_t{};
+      for (auto view : views) {
+        const auto copy = std::string{view.data(), view.size()};
+        total += std::strtoull(copy.c_str(), nullptr, 10);
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+  }
+
+  void bpstd_from_chars_integer(benchmark::State& state)
+  {
+    const auto strings = make_integer_strings(value_count);
+    const auto views = std::vector<bpstd::string_view>{strings.begin(), strings.end()};
+
+    for (auto _ : state) {
+      auto total = std::uint64_t{};
+      for (auto view : views) {
+        auto value = std::uint64_t{};
+        bpstd::from_chars(view, value);
+        total += value;
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * views.size()));
+  }
+
+  //----------------------------------------------------------------------------
+  // Formatting
+  //----------------------------------------------------------------------------
+
+  /// \brief Formats with "%.17g", the shortest printf format that always
+  ///        round-trips
+  void snprintf_format_double(benchmark::State& state)
+  {
+    const auto values = make_doubles(value_count);
+
+    for (auto _ : state) {
+      for (auto v : values) {
+        char buffer[32];
+        benchmark::DoNotOptimize(std::snprintf(buffer, sizeof(buffer), "%.17g", v));
+        benchmark::ClobberMemory();
+      }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * values.size()));
+  }
+
+  void bpstd_to_chars_double(benchmark::State& state)
+  {
+    const auto values = make_doubles(value_count);
+
+    for (auto _ : state) {
+      for (auto v : values) {
+        char buffer[32];
+        benchmark::DoNotOptimize(bpstd::to_chars(buffer, buffer + sizeof(buffer), v));
+        benchmark::ClobberMemory();
+      }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * values.size()));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(strtod_parse_double);
+BENCHMARK(bpstd_from_chars_double);
+BENCHMARK(strtoull_parse_integer);
+BENCHMARK(bpstd_from_chars_integer);
+BENCHMARK(snprintf_format_double);
+BENCHMARK(bpstd_to_chars_double);
@@ -0,0 +1,275 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/functional.hpp>
+#include <bpstd/string_view.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int64_t
+#include <deque>      // std::deque
+#include <functional> // std::function, std::invoke
+#include <memory>     // std::unique_ptr
+#include <random>     // std::mt19937
+#include <string>     // std::string
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+namespace {
+
+  struct widget
+  {
+    int value;
+
+    int get() const noexcept { return value; }
+  };
+
+  int add(int a, int b) noexcept { return a + b; }
+
+  /// \brief A callable that captures enough state to exceed the small
+  ///        buffer of most std::function implementations
+  struct large_task
+  {
+    int* counter;
+    int padding[6];
+
+    void operator()() const noexcept { ++*counter; }
+  };
+
+  /// \brief A move-only callable, which std::function cannot store
+  struct move_only_task
+  {
+    std::unique_ptr<int> counter;
+
+    void operator()() const noexcept { ++*counter; }
+  };
+
+  //----------------------------------------------------------------------------
+  // invoke
+  //----------------------------------------------------------------------------
+
+  void bpstd_invoke_member_function(benchmark::State& state)
+  {
+    auto w = widget{42};
+    auto fn = &widget::get;
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(fn);
+      benchmark::DoNotOptimize(bpstd::invoke(fn, w));
+    }
+  }
+
+  void bpstd_invoke_member_data(benchmark::State& state)
+  {
+    auto w = widget{42};
+    auto ptr = &widget::value;
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(ptr);
+      benchmark::DoNotOptimize(bpstd::invoke(ptr, w));
+    }
+  }
+
+#if __cplusplus >= 201703L
+  void std_invoke_member_function(benchmark::State& state)
+  {
+    auto w = widget{42};
+    auto fn = &widget::get;
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(fn);
+      benchmark::DoNotOptimize(std::invoke(fn, w));
+    }
+  }
+
+  void std_invoke_member_data(benchmark::State& state)
+  {
+    auto w = widget{42};
+    auto ptr = &widget::value;
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(ptr);
+      benchmark::DoNotOptimize(std::invoke(ptr, w));
+    }
+  }
+#endif
+
+  //----------------------------------------------------------------------------
+  // Type-erased calls
+  //----------------------------------------------------------------------------
+
+  template <typename Function>
+  void function_call(benchmark::State& state)
+  {
+    auto fn = Function{&add};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(fn);
+      benchmark::DoNotOptimize(fn(1, 2));
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Task queues
+  //----------------------------------------------------------------------------
+
+  constexpr auto task_count = std::size_t{256u};
+
+  // Pushes and then drains a queue of tasks, as a work queue would
+  template <typename Function, typename Task>
+  void function_task_queue(benchmark::State& state)
+  {
+    auto counter = 0;
+    auto queue = std::deque<Function>{};
+
+    for (auto _ : state) {
+      for (auto i = std::size_t{0u}; i < task_count; ++i) {
+        queue.emplace_back(Task{&counter, {}});
+      }
+      while (!queue.empty()) {
+        auto task = std::move(queue.front());
+        queue.pop_front();
+        task();
+      }
+      benchmark::DoNotOptimize(counter);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * task_count));
+  }
+
+  template <typename Function>
+  void function_move_only_task_queue(benchmark::State& state)
+  {
+    auto queue = std::deque<Function>{};
+
+    for (auto _ : state) {
+      for (auto i = std::size_t{0u}; i < task_count; ++i) {
+        queue.emplace_back(move_only_task{std::unique_ptr<int>{new int{0}}});
+      }
+      while (!queue.empty()) {
+        auto task = std::move(queue.front());
+        queue.pop_front();
+        task();
+      }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * task_count));
+  }
+
+  using large_inplace_function = bpstd::inplace_function<void(), sizeof(large_task)>;
+
+  //----------------------------------------------------------------------------
+  // Searchers
+  //----------------------------------------------------------------------------
+
+  constexpr auto buffer_count = std::size_t{256u};
+  constexpr auto buffer_size = std::size_t{4096u};
+  const auto needle = bpstd::string_view{"installation"};
+
+  /// \brief Makes buffers of text from a small alphabet, each of which ends
+  ///        with the needle
+  ///
+  /// The alphabet shares its letters with the needle, so that partial
+  /// matches are frequent, as they are in natural text.
+  std::vector<std::string> make_buffers()
+  {
+    const auto alphabet = bpstd::string_view{"etaoinshrdlu "};
+
+    auto engine = std::mt19937{42u};
+    auto result = std::vector<std::string>{};
+    for (auto i = std::size_t{0u}; i < buffer_count; ++i) {
+      auto buffer = std::string{};
+      while (buffer.size() < buffer_size - needle.size()) {
+        buffer += alphabet[engine() % alphabet.size()];
+      }
+      buffer.append(needle.data(), needle.size());
+      result.push_back(std::move(buffer));
+    }
+    return result;
+  }
+
+  void string_view_find(benchmark::State& state)
+  {
+    const auto buffers = make_buffers();
+
+    for (auto _ : state) {
+      for (const auto& buffer : buffers) {
+        benchmark::DoNotOptimize(bpstd::string_view{buffer}.find(needle));
+      }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer_count * buffer_size));
+  }
+
+  // Searches every buffer with a searcher that is only constructed once
+  template <typename Searcher>
+  void searcher_find(benchmark::State& state, const Searcher& searcher)
+  {
+    const auto buffers = make_buffers();
+
+    for (auto _ : state) {
+      for (const auto& buffer : buffers) {
+        const auto view = bpstd::string_view{buffer};
+        benchmark::DoNotOptimize(searcher(view.begin(), view.end()));
+      }
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer_count * buffer_size));
+  }
+
+  void default_searcher_find(benchmark::State& state)
+  {
+    searcher_find(state, bpstd::make_default_searcher(needle.begin(), needle.end()));
+  }
+
+  void boyer_moore_horspool_searcher_find(benchmark::State& state)
+  {
+    searcher_find(state, bpstd::make_boyer_moore_horspool_searcher(needle.begin(), needle.end()));
+  }
+
+  void boyer_moore_searcher_find(benchmark::State& state)
+  {
+    searcher_find(state, bpstd::make_boyer_moore_searcher(needle.begin(), needle.end()));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(bpstd_invoke_member_function);
+BENCHMARK(bpstd_invoke_member_data);
+#if __cplusplus >= 201703L
+BENCHMARK(std_invoke_member_function);
+BENCHMARK(std_invoke_member_data);
+#endif
+
+BENCHMARK_TEMPLATE(function_call, bpstd::function_ref<int(int,int)>);
+BENCHMARK_TEMPLATE(function_call, bpstd::unique_function<int(int,int)>);
+BENCHMARK_TEMPLATE(function_call, std::function<int(int,int)>);
+
+BENCHMARK_TEMPLATE(function_task_queue, bpstd::unique_function<void()>, large_task);
+BENCHMARK_TEMPLATE(function_task_queue, large_inplace_function, large_task);
+BENCHMARK_TEMPLATE(function_task_queue, std::function<void()>, large_task);
+BENCHMARK_TEMPLATE(function_move_only_task_queue, bpstd::unique_function<void()>);
+
+BENCHMARK(string_view_find);
+BENCHMARK(default_searcher_find);
+BENCHMARK(boyer_moore_horspool_searcher_find);
+BENCHMARK(boyer_moore_searcher_find);
@@ -0,0 +1,111 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/mapped_file.hpp>
+
+#include <benchmark/benchmark.h>
+
+#if BPSTD_HAS_MAPPED_FILE
+
+#include <algorithm> // std::count
+#include <cstdint>   // std::int64_t
+#include <cstdio>    // std::fopen, std::fwrite, std::remove
+#include <fstream>   // std::ifstream
+#include <iterator>  // std::istreambuf_iterator
+#include <string>    // std::string
+
+namespace {
+
+  constexpr auto file_size = std::size_t{64u << 20u};
+
+  /// \brief A file of lines, that is removed when the benchmarks exit
+  class lines_file
+  {
+  public:
+    lines_file()
+    {
+      auto* file = std::fopen(path(), "wb");
+      const auto line = std::string{"the quick brown fox jumps over the lazy dog\n"};
+      for (auto written = std::size_t{0u}; written < file_size; written += line.size()) {
+        std::fwrite(line.data(), 1u, line.size(), file);
+      }
+      std::fclose(file);
+    }
+
+    ~lines_file()
+    {
+      std::remove(path());
+    }
+
+    const char* path() const noexcept { return "bpstd-mapped-file.bench.txt"; }
+  };
+
+  /// \brief Gets the path to the file of lines, creating it on first use
+  const char* lines_path()
+  {
+    static const lines_file s_file;
+
+    return s_file.path();
+  }
+
+  /// \brief Counts lines after reading the whole file into a std::string
+  void read_into_string_count_lines(benchmark::State& state)
+  {
+    const auto* path = lines_path();
+
+    for (auto _ : state) {
+      auto stream = std::ifstream{path, std::ios::binary};
+      const auto contents = std::string{
+        std::istreambuf_iterator<char>{stream},
+        std::istreambuf_iterator<char>{}
+      };
+      benchmark::DoNotOptimize(std::count(contents.begin(), contents.end(), '\n'));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+  }
+
+  /// \brief Counts lines through a mapping of the file
+  void mapped_file_count_lines(benchmark::State& state)
+  {
+    const auto* path = lines_path();
+
+    for (auto _ : state) {
+      const auto file = bpstd::mapped_file{
+        path,
+        bpstd::mapped_file::access_advice::sequential
+      };
+      const auto contents = file.view();
+      benchmark::DoNotOptimize(std::count(contents.begin(), contents.end(), '\n'));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(read_into_string_count_lines)->Unit(benchmark::kMillisecond);
+BENCHMARK(mapped_file_count_lines)->Unit(benchmark::kMillisecond);
+
+#endif /* BPSTD_HAS_MAPPED_FILE */
@@ -0,0 +1,133 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/optional.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <vector>  // std::vector
+
+#if __cplusplus >= 201703L
+# include <optional> // std::optional
+#endif
+
+namespace {
+
+  constexpr auto optional_count = std::size_t{4096u};
+
+  /// \brief Makes a sequence of optionals where every third is disengaged
+  template <typename Optional>
+  std::vector<Optional> make_optionals(std::size_t size)
+  {
+    auto result = std::vector<Optional>(size);
+    for (auto i = std::size_t{0u}; i < size; ++i) {
+      if (i % 3u != 0u) {
+        result[i] = static_cast<int>(i);
+      }
+    }
+    return result;
+  }
+
+  struct add_one
+  {
+    int operator()(int x) const noexcept { return x + 1; }
+  };
+
+  //----------------------------------------------------------------------------
+
+  template <typename Optional>
+  void optional_access(benchmark::State& state)
+  {
+    const auto optionals = make_optionals<Optional>(optional_count);
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (const auto& o : optionals) {
+        if (o.has_value()) {
+          sum += *o;
+        }
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * optional_count));
+  }
+
+  template <typename Optional>
+  void optional_value_or(benchmark::State& state)
+  {
+    const auto optionals = make_optionals<Optional>(optional_count);
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (const auto& o : optionals) {
+        sum += o.value_or(-1);
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * optional_count));
+  }
+
+  template <typename Optional>
+  void optional_assign(benchmark::State& state)
+  {
+    auto optionals = make_optionals<Optional>(optional_count);
+
+    for (auto _ : state) {
+      for (auto i = std::size_t{0u}; i < optional_count; ++i) {
+        optionals[i] = optionals[optional_count - i - 1u];
+      }
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * optional_count));
+  }
+
+  void optional_transform(benchmark::State& state)
+  {
+    const auto optionals = make_optionals<bpstd::optional<int>>(optional_count);
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (const auto& o : optionals) {
+        sum += o.transform(add_one{}).transform(add_one{}).value_or(0);
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * optional_count));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(optional_access, bpstd::optional<int>);
+BENCHMARK_TEMPLATE(optional_value_or, bpstd::optional<int>);
+BENCHMARK_TEMPLATE(optional_assign, bpstd::optional<int>);
+BENCHMARK(optional_transform);
+
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(optional_access, std::optional<int>);
+BENCHMARK_TEMPLATE(optional_value_or, std::optional<int>);
+BENCHMARK_TEMPLATE(optional_assign, std::optional<int>);
+#endif
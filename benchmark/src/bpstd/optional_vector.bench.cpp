@@ -0,0 +1,96 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/optional_vector.hpp>
+#include <bpstd/optional.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <vector>  // std::vector
+
+namespace {
+
+  constexpr auto element_count = std::size_t{1u << 16u};
+
+  /// \brief Checks whether the element at \p index should contain a value,
+  ///        given that \p percent percent of the elements contain values
+  bool is_present(std::size_t index, std::int64_t percent)
+  {
+    // A multiplicative hash spreads the present elements out evenly
+    return static_cast<std::int64_t>((index * 2654435761u) % 100u) < percent;
+  }
+
+  /// \brief Sums the values in a vector of optionals
+  void vector_of_optional_sum(benchmark::State& state)
+  {
+    auto values = std::vector<bpstd::optional<int>>(element_count);
+    for (auto i = std::size_t{0u}; i < element_count; ++i) {
+      if (is_present(i, state.range(0))) {
+        values[i] = static_cast<int>(i);
+      }
+    }
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (const auto& v : values) {
+        if (v.has_value()) {
+          sum += *v;
+        }
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+  }
+
+  /// \brief Sums the values in an optional_vector
+  void optional_vector_sum(benchmark::State& state)
+  {
+    auto values = bpstd::optional_vector<int>{};
+    values.reserve(element_count);
+    for (auto i = std::size_t{0u}; i < element_count; ++i) {
+      if (is_present(i, state.range(0))) {
+        values.push_back(static_cast<int>(i));
+      } else {
+        values.push_back(bpstd::nullopt);
+      }
+    }
+
+    for (auto _ : state) {
+      auto sum = 0;
+      values.for_each_value([&](std::size_t, int v) {
+        sum += v;
+      });
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+// The argument is the percentage of elements that contain a value
+BENCHMARK(vector_of_optional_sum)->Arg(1)->Arg(10)->Arg(50)->Arg(100);
+BENCHMARK(optional_vector_sum)->Arg(1)->Arg(10)->Arg(50)->Arg(100);
@@ -0,0 +1,114 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/record_reader.hpp>
+
+#include <benchmark/benchmark.h>
+
+#if BPSTD_HAS_RECORD_READER
+
+#include <cstdint>   // std::int64_t
+#include <cstdio>    // std::fopen, std::fwrite, std::remove
+#include <fstream>   // std::ifstream
+#include <string>    // std::string, std::getline
+#include <fcntl.h>   // ::open
+#include <unistd.h>  // ::close
+
+namespace {
+
+  constexpr auto file_size = std::size_t{64u << 20u};
+
+  /// \brief A file of lines, that is removed when the benchmarks exit
+  class lines_file
+  {
+  public:
+    lines_file()
+    {
+      auto* file = std::fopen(path(), "wb");
+      const auto line = std::string{"the quick brown fox jumps over the lazy dog\n"};
+      for (auto written = std::size_t{0u}; written < file_size; written += line.size()) {
+        std::fwrite(line.data(), 1u, line.size(), file);
+      }
+      std::fclose(file);
+    }
+
+    ~lines_file()
+    {
+      std::remove(path());
+    }
+
+    const char* path() const noexcept { return "bpstd-record-reader.bench.txt"; }
+  };
+
+  /// \brief Gets the path to the file of lines, creating it on first use
+  const char* lines_path()
+  {
+    static const lines_file s_file;
+
+    return s_file.path();
+  }
+
+  /// \brief Sums the length of each line read with std::getline
+  void getline_sum_lines(benchmark::State& state)
+  {
+    const auto* path = lines_path();
+
+    for (auto _ : state) {
+      auto stream = std::ifstream{path, std::ios::binary};
+      auto line = std::string{};
+      auto total = std::size_t{0u};
+      while (std::getline(stream, line)) {
+        total += line.size();
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+  }
+
+  /// \brief Sums the length of each line read with a record_reader
+  void record_reader_sum_lines(benchmark::State& state)
+  {
+    const auto* path = lines_path();
+
+    for (auto _ : state) {
+      const auto fd = ::open(path, O_RDONLY);
+      auto reader = bpstd::record_reader{fd};
+      auto total = std::size_t{0u};
+      while (auto line = reader.next()) {
+        total += line->size();
+      }
+      benchmark::DoNotOptimize(total);
+      ::close(fd);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * file_size));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(getline_sum_lines)->Unit(benchmark::kMillisecond);
+BENCHMARK(record_reader_sum_lines)->Unit(benchmark::kMillisecond);
+
+#endif /* BPSTD_HAS_RECORD_READER */
@@ -0,0 +1,137 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/span.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <numeric> // std::iota
+#include <vector>  // std::vector
+
+#if __cplusplus >= 202002L
+# include <span> // std::span
+#endif
+
+namespace {
+
+  constexpr auto element_count = std::size_t{4096u};
+
+  std::vector<int> make_values()
+  {
+    auto result = std::vector<int>(element_count);
+    std::iota(result.begin(), result.end(), 0);
+    return result;
+  }
+
+  //----------------------------------------------------------------------------
+
+  /// \brief Sums the elements through a raw pointer range, as the baseline
+  void pointer_iterate(benchmark::State& state)
+  {
+    auto values = make_values();
+    const auto* first = values.data();
+    const auto* last = values.data() + values.size();
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(first);
+      auto sum = 0;
+      for (auto it = first; it != last; ++it) {
+        sum += *it;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+  }
+
+  template <typename Span>
+  void span_iterate(benchmark::State& state)
+  {
+    auto values = make_values();
+    auto s = Span{values.data(), values.size()};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(s);
+      auto sum = 0;
+      for (auto v : s) {
+        sum += v;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+  }
+
+  template <typename Span>
+  void span_index(benchmark::State& state)
+  {
+    auto values = make_values();
+    auto s = Span{values.data(), values.size()};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(s);
+      auto sum = 0;
+      for (auto i = std::size_t{0u}; i < s.size(); ++i) {
+        sum += s[i];
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count));
+  }
+
+  template <typename Span>
+  void span_subspan(benchmark::State& state)
+  {
+    auto values = make_values();
+    auto s = Span{values.data(), values.size()};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(s);
+      auto sum = 0;
+      for (auto i = std::size_t{0u}; i < s.size(); i += 64u) {
+        sum += s.subspan(i, 64u).front();
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * element_count / 64u));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(pointer_iterate);
+
+BENCHMARK_TEMPLATE(span_iterate, bpstd::span<const int>);
+BENCHMARK_TEMPLATE(span_iterate, bpstd::span<const int, element_count>);
+BENCHMARK_TEMPLATE(span_index, bpstd::span<const int>);
+BENCHMARK_TEMPLATE(span_index, bpstd::span<const int, element_count>);
+BENCHMARK_TEMPLATE(span_subspan, bpstd::span<const int>);
+
+#if __cplusplus >= 202002L
+BENCHMARK_TEMPLATE(span_iterate, std::span<const int>);
+BENCHMARK_TEMPLATE(span_iterate, std::span<const int, element_count>);
+BENCHMARK_TEMPLATE(span_index, std::span<const int>);
+BENCHMARK_TEMPLATE(span_index, std::span<const int, element_count>);
+BENCHMARK_TEMPLATE(span_subspan, std::span<const int>);
+#endif
@@ -0,0 +1,95 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/split.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int64_t
+#include <sstream>  // std::istringstream
+#include <string>   // std::string, std::getline
+#include <vector>   // std::vector
+
+namespace {
+
+  /// \brief Makes \p rows lines of comma-separated values, some of them empty
+  std::string make_csv(std::size_t rows)
+  {
+    auto result = std::string{};
+    for (auto i = std::size_t{0u}; i < rows; ++i) {
+      result += "1024,gateway,,GET,/index.html,200,,text/html\n";
+    }
+    return result;
+  }
+
+  /// \brief Splits each line into a std::vector of std::string fields
+  void vector_split_csv(benchmark::State& state)
+  {
+    const auto csv = make_csv(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+      auto stream = std::istringstream{csv};
+      auto line = std::string{};
+      auto total = std::size_t{0u};
+      while (std::getline(stream, line)) {
+        auto fields = std::vector<std::string>{};
+        auto field_stream = std::istringstream{line};
+        auto field = std::string{};
+        while (std::getline(field_stream, field, ',')) {
+          fields.push_back(field);
+        }
+        total += fields.size();
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(csv.size()));
+  }
+
+  /// \brief Splits each line into fields with bpstd::split
+  void bpstd_split_csv(benchmark::State& state)
+  {
+    const auto csv = make_csv(static_cast<std::size_t>(state.range(0)));
+    const auto view = bpstd::string_view{csv};
+
+    for (auto _ : state) {
+      auto total = std::size_t{0u};
+      for (auto line : bpstd::split(view, '\n', bpstd::empty_fields::skip)) {
+        for (auto field : bpstd::split(line, ',')) {
+          total += 1u;
+          benchmark::DoNotOptimize(field);
+        }
+      }
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(csv.size()));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK(vector_split_csv)->Range(1, 1 << 12);
+BENCHMARK(bpstd_split_csv)->Range(1, 1 << 12);
@@ -0,0 +1,137 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/string_view.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::int64_t
+#include <functional> // std::hash
+#include <string>     // std::string
+
+#if __cplusplus >= 201703L
+# include <string_view> // std::string_view
+#endif
+
+namespace {
+
+  /// \brief Makes a haystack of \p size characters that does not contain
+  ///        the needle until its last few characters
+  std::string make_haystack(std::size_t size)
+  {
+    auto result = std::string(size, 'a');
+    for (auto i = std::size_t{0u}; i < size; i += 7u) {
+      result[i] = 'b';
+    }
+    result.replace(size - 4u, 4u, "needle", 4u);
+    return result;
+  }
+
+  template <typename StringView>
+  void string_view_find(benchmark::State& state)
+  {
+    const auto storage = make_haystack(static_cast<std::size_t>(state.range(0)));
+    const auto haystack = StringView{storage.data(), storage.size()};
+    const auto needle = StringView{"need"};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(haystack.find(needle));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+  }
+
+  template <typename StringView>
+  void string_view_find_char(benchmark::State& state)
+  {
+    const auto storage = make_haystack(static_cast<std::size_t>(state.range(0)));
+    const auto haystack = StringView{storage.data(), storage.size()};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(haystack.find('n'));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+  }
+
+  template <typename StringView>
+  void string_view_find_first_of(benchmark::State& state)
+  {
+    const auto storage = make_haystack(static_cast<std::size_t>(state.range(0)));
+    const auto haystack = StringView{storage.data(), storage.size()};
+    const auto set = StringView{"xyzn"};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(haystack.find_first_of(set));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+  }
+
+  template <typename StringView>
+  void string_view_compare(benchmark::State& state)
+  {
+    const auto lhs_storage = make_haystack(static_cast<std::size_t>(state.range(0)));
+    const auto rhs_storage = lhs_storage;
+    const auto lhs = StringView{lhs_storage.data(), lhs_storage.size()};
+    const auto rhs = StringView{rhs_storage.data(), rhs_storage.size()};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(lhs.compare(rhs));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+  }
+
+  template <typename StringView>
+  void string_view_hash(benchmark::State& state)
+  {
+    const auto storage = make_haystack(static_cast<std::size_t>(state.range(0)));
+    const auto view = StringView{storage.data(), storage.size()};
+    const auto hasher = std::hash<StringView>{};
+
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(hasher(view));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            state.range(0));
+  }
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(string_view_find, bpstd::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_find_char, bpstd::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_find_first_of, bpstd::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_compare, bpstd::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_hash, bpstd::string_view)->Range(4, 1 << 16);
+
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(string_view_find, std::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_find_char, std::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_find_first_of, std::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_compare, std::string_view)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(string_view_hash, std::string_view)->Range(4, 1 << 16);
+#endif
@@ -0,0 +1,188 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/variant.hpp>
+
+#include <benchmark/benchmark.h>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int64_t
+#include <vector>  // std::vector
+
+#if __cplusplus >= 201703L
+# include <variant> // std::variant
+#endif
+
+namespace {
+
+  template <std::size_t N>
+  struct alternative
+  {
+    int value;
+  };
+
+  /// \brief A visitor that sums the values of each visited alternative
+  struct sum_visitor
+  {
+    template <typename...Alternatives>
+    int operator()(const Alternatives&...alternatives) const noexcept
+    {
+      auto result = 0;
+      const int values[] = {alternatives.value...};
+      for (auto v : values) {
+        result += v;
+      }
+      return result;
+    }
+  };
+
+  //----------------------------------------------------------------------------
+
+  template <template <typename...> class Variant, typename Sequence>
+  struct make_variant_impl;
+
+  template <template <typename...> class Variant, std::size_t...Idxs>
+  struct make_variant_impl<Variant, bpstd::index_sequence<Idxs...>>
+  {
+    using type = Variant<alternative<Idxs>...>;
+
+    static type make(std::size_t index)
+    {
+      using factory = type(*)(int);
+      static const factory factories[] = {&make_alternative<Idxs>...};
+
+      return factories[index % sizeof...(Idxs)](static_cast<int>(index));
+    }
+
+    template <std::size_t Idx>
+    static type make_alternative(int value)
+    {
+      return type{alternative<Idx>{value}};
+    }
+  };
+
+  /// \brief A variant with \p N alternatives, each of a distinct type
+  template <template <typename...> class Variant, std::size_t N>
+  using make_variant = make_variant_impl<Variant, bpstd::make_index_sequence<N>>;
+
+  /// \brief Makes a sequence of variants that cycle through every alternative
+  template <template <typename...> class Variant, std::size_t N>
+  std::vector<typename make_variant<Variant,N>::type> make_variants(std::size_t size)
+  {
+    auto result = std::vector<typename make_variant<Variant,N>::type>{};
+    result.reserve(size);
+    for (auto i = std::size_t{0u}; i < size; ++i) {
+      // Multiply by a prime so the active alternative is not a simple cycle
+      result.push_back(make_variant<Variant,N>::make(i * 7u));
+    }
+    return result;
+  }
+
+  constexpr auto variant_count = std::size_t{1024u};
+
+  //----------------------------------------------------------------------------
+
+  template <template <typename...> class Variant, std::size_t N>
+  void visit_unary(benchmark::State& state)
+  {
+    const auto variants = make_variants<Variant,N>(variant_count);
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (const auto& v : variants) {
+        sum += visit(sum_visitor{}, v);
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * variant_count));
+  }
+
+  template <template <typename...> class Variant, std::size_t N>
+  void visit_binary(benchmark::State& state)
+  {
+    const auto lhs = make_variants<Variant,N>(variant_count);
+    const auto rhs = make_variants<Variant,N>(variant_count + 1u);
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (auto i = std::size_t{0u}; i < variant_count; ++i) {
+        sum += visit(sum_visitor{}, lhs[i], rhs[i + 1u]);
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * variant_count));
+  }
+
+  template <template <typename...> class Variant, std::size_t N>
+  void visit_ternary(benchmark::State& state)
+  {
+    const auto v0 = make_variants<Variant,N>(variant_count);
+    const auto v1 = make_variants<Variant,N>(variant_count + 1u);
+    const auto v2 = make_variants<Variant,N>(variant_count + 2u);
+
+    for (auto _ : state) {
+      auto sum = 0;
+      for (auto i = std::size_t{0u}; i < variant_count; ++i) {
+        sum += visit(sum_visitor{}, v0[i], v1[i + 1u], v2[i + 2u]);
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * variant_count));
+  }
+
+  // 'visit' is found by argument-dependent lookup in each variant's namespace
+  template <typename...Types>
+  using bpstd_variant = bpstd::variant<Types...>;
+
+#if __cplusplus >= 201703L
+  template <typename...Types>
+  using std_variant = std::variant<Types...>;
+#endif
+
+} // namespace
+
+//------------------------------------------------------------------------------
+
+BENCHMARK_TEMPLATE(visit_unary, bpstd_variant, 2);
+BENCHMARK_TEMPLATE(visit_unary, bpstd_variant, 8);
+BENCHMARK_TEMPLATE(visit_unary, bpstd_variant, 32);
+BENCHMARK_TEMPLATE(visit_unary, bpstd_variant, 64);
+BENCHMARK_TEMPLATE(visit_binary, bpstd_variant, 2);
+BENCHMARK_TEMPLATE(visit_binary, bpstd_variant, 8);
+BENCHMARK_TEMPLATE(visit_binary, bpstd_variant, 16);
+BENCHMARK_TEMPLATE(visit_ternary, bpstd_variant, 2);
+BENCHMARK_TEMPLATE(visit_ternary, bpstd_variant, 4);
+BENCHMARK_TEMPLATE(visit_ternary, bpstd_variant, 8);
+
+#if __cplusplus >= 201703L
+BENCHMARK_TEMPLATE(visit_unary, std_variant, 2);
+BENCHMARK_TEMPLATE(visit_unary, std_variant, 8);
+BENCHMARK_TEMPLATE(visit_unary, std_variant, 32);
+BENCHMARK_TEMPLATE(visit_unary, std_variant, 64);
+BENCHMARK_TEMPLATE(visit_binary, std_variant, 2);
+BENCHMARK_TEMPLATE(visit_binary, std_variant, 8);
+BENCHMARK_TEMPLATE(visit_binary, std_variant, 16);
+BENCHMARK_TEMPLATE(visit_ternary, std_variant, 2);
+BENCHMARK_TEMPLATE(visit_ternary, std_variant, 4);
+BENCHMARK_TEMPLATE(visit_ternary, std_variant, 8);
+#endif
@@ -0,0 +1,68 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <cstring> // std::strncmp
+#include <vector>  // std::vector
+
+namespace {
+
+  /// \brief Checks whether \p arg selects the output format explicitly
+  ///
+  /// \param arg the command-line argument
+  /// \return true if \p arg is '--benchmark_format'
+  bool is_format_argument(const char* arg)
+  {
+    static constexpr char format[] = "--benchmark_format";
+
+    return std::strncmp(arg, format, sizeof(format) - 1u) == 0;
+  }
+
+} // namespace
+
+// The results are reported as JSON by default so that runs can be compared
+// by tooling; passing '--benchmark_format=console' restores the normal table.
+int main(int argc, char** argv)
+{
+  auto args = std::vector<char*>{argv, argv + argc};
+  auto has_format = false;
+  for (auto i = 1; i < argc; ++i) {
+    has_format = has_format || is_format_argument(argv[i]);
+  }
+
+  char json_format[] = "--benchmark_format=json";
+  if (!has_format) {
+    args.push_back(json_format);
+  }
+
+  auto size = static_cast<int>(args.size());
+  ::benchmark::Initialize(&size, args.data());
+  if (::benchmark::ReportUnrecognizedArguments(size, args.data())) {
+    return 1;
+  }
+  ::benchmark::RunSpecifiedBenchmarks();
+  ::benchmark::Shutdown();
+  return 0;
+}
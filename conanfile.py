@@ -18,14 +18,19 @@ class BackportConan(ConanFile):
   exports_sources = ("cmake/*",
                      "include/*",
                      "test/*",
+                     "benchmark/*",
                      "CMakeLists.txt",
                      "LICENSE")
 
   # Settings
-  options = {}
-  default_options = {}
+  options = {"benchmarks": [True, False]}
+  default_options = {"benchmarks": False}
   build_requires = ("Catch2/2.7.1@catchorg/stable")
 
+  def build_requirements(self):
+    if self.options.benchmarks:
+      self.build_requires("benchmark/1.5.2")
+
   def source(self):
     pass
 
@@ -38,6 +43,7 @@ class BackportConan(ConanFile):
   def package(self):
     cmake = CMake(self)
     cmake.definitions["BACKPORT_COMPILE_UNIT_TESTS"] = "ON"
+    cmake.definitions["BACKPORT_COMPILE_BENCHMARKS"] = "ON" if self.options.benchmarks else "OFF"
     cmake.configure()
 
     # Compile and run the unit tests
@@ -0,0 +1,521 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file aho_corasick.hpp
+///
+/// \brief This header provides a matcher for many patterns at once
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_AHO_CORASICK_HPP
+#define BPSTD_AHO_CORASICK_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "string_view.hpp" // string_view
+
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t
+#include <initializer_list> // std::initializer_list
+#include <limits>           // std::numeric_limits
+#include <stdexcept>        // std::invalid_argument, std::length_error
+#include <utility>          // std::move
+#include <vector>           // std::vector
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : aho_corasick
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A matcher that finds every occurrence of many patterns in a
+  ///        single pass over the text
+  ///
+  /// The patterns are compiled into a deterministic automaton (Aho and
+  /// Corasick, "Efficient String Matching", 1975), so each byte of text costs
+  /// one table lookup no matter how many patterns there are.
+  ///
+  /// The transition table is a single flat array. Bytes that no pattern
+  /// distinguishes between share a column, which keeps the table small
+  /// enough to stay in cache for hundreds of patterns. States are stored as
+  /// offsets into the table, and the states that report matches are
+  /// numbered last, so the scanning loop is a load and a compare per byte.
+  ///
+  /// Text may be fed in chunks through a \c scanner, which carries the state
+  /// of the automaton across calls, so matches that span chunks are found.
+  ///
+  /// \code
+  /// const auto matcher = bpstd::aho_corasick{"he", "she", "hers"};
+  /// auto scanner = bpstd::aho_corasick::scanner{matcher};
+  /// for (auto chunk : chunks) {
+  ///   scanner.feed(chunk, [](bpstd::aho_corasick::match m) {
+  ///     report(m.pattern, m.offset);
+  ///   });
+  /// }
+  /// \endcode
+  //////////////////////////////////////////////////////////////////////////////
+  class aho_corasick
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using size_type = std::size_t;
+
+    /// \brief An occurrence of a pattern
+    struct match
+    {
+      size_type pattern; ///< The index of the pattern that matched
+      size_type offset;  ///< The offset of the start of the match in the text
+    };
+
+    class scanner;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a matcher for the patterns in [first, last)
+    ///
+    /// Patterns are identified by their index in the range. The patterns are
+    /// not referenced after construction.
+    ///
+    /// \throw std::invalid_argument if any pattern is empty
+    /// \throw std::length_error if the automaton is too large to index
+    /// \param first the start of the patterns
+    /// \param last the end of the patterns
+    template <typename ForwardIt>
+    aho_corasick(ForwardIt first, ForwardIt last);
+
+    /// \brief Constructs a matcher for the patterns in \p patterns
+    ///
+    /// \throw std::invalid_argument if any pattern is empty
+    /// \throw std::length_error if the automaton is too large to index
+    /// \param patterns the patterns to match
+    aho_corasick(std::initializer_list<string_view> patterns);
+
+    //--------------------------------------------------------------------------
+    // Matching
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Invokes \p fn with every match in \p text
+    ///
+    /// Matches are reported in order of where they end; matches that end at
+    /// the same offset are reported longest first.
+    ///
+    /// \param text the text to search
+    /// \param fn the function to invoke with each match
+    template <typename Fn>
+    void find_all(string_view text, Fn&& fn) const;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of patterns being matched
+    ///
+    /// \return the number of patterns
+    size_type pattern_count() const noexcept;
+
+    /// \brief Gets the number of states in the automaton
+    ///
+    /// \return the number of states
+    size_type state_count() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief A state, as the offset of its row in the transition table
+    using state_type = std::uint32_t;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Builds the automaton that matches \p patterns
+    ///
+    /// \param patterns the patterns, in order
+    void build(const std::vector<string_view>& patterns);
+
+    /// \brief Invokes \p fn with the matches that end in \p state
+    ///
+    /// \param state a state at or after m_first_match_state
+    /// \param end the offset in the text just past the end of the matches
+    /// \param fn the function to invoke with each match
+    template <typename Fn>
+    void report(state_type state, size_type end, Fn& fn) const;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    std::vector<state_type> m_transitions;   // [state + byte class] -> state
+    std::vector<size_type> m_match_first;    // per match state, into m_matches
+    std::vector<size_type> m_matches;        // pattern indices
+    std::vector<size_type> m_pattern_sizes;
+    state_type m_first_match_state;
+    state_type m_stride;                     // the number of byte classes
+    unsigned char m_byte_classes[256];
+  };
+
+  //============================================================================
+  // class : aho_corasick::scanner
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Matches the patterns of an aho_corasick in text that arrives in
+  ///        chunks
+  ///
+  /// Offsets are counted from the start of the first chunk fed, and a match
+  /// is reported by the call that feeds its last byte. The matcher must
+  /// outlive the scanner.
+  //////////////////////////////////////////////////////////////////////////////
+  class aho_corasick::scanner
+  {
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a scanner at the start of a text
+    ///
+    /// \param matcher the matcher to scan with
+    explicit scanner(const aho_corasick& matcher) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Scanning
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Feeds the next chunk of text, invoking \p fn with every match
+    ///        that ends in it
+    ///
+    /// \param chunk the next chunk of the text
+    /// \param fn the function to invoke with each match
+    template <typename Fn>
+    void feed(string_view chunk, Fn&& fn);
+
+    /// \brief Returns this scanner to the start of a new text
+    void reset() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of bytes fed since the start of the text
+    ///
+    /// \return the offset of the next byte to be fed
+    size_type offset() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    const aho_corasick* m_matcher;
+    state_type m_state;
+    size_type m_offset;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// class : aho_corasick
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename ForwardIt>
+inline
+bpstd::aho_corasick::aho_corasick(ForwardIt first, ForwardIt last)
+  : m_first_match_state{0u},
+    m_stride{1u},
+    m_byte_classes{}
+{
+  auto patterns = std::vector<string_view>{};
+  for (; first != last; ++first) {
+    patterns.push_back(string_view{*first});
+  }
+  build(patterns);
+}
+
+inline
+bpstd::aho_corasick::aho_corasick(std::initializer_list<string_view> patterns)
+  : aho_corasick(patterns.begin(), patterns.end())
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Matching
+//------------------------------------------------------------------------------
+
+template <typename Fn>
+inline
+void bpstd::aho_corasick::find_all(string_view text, Fn&& fn)
+  const
+{
+  auto s = scanner{*this};
+  s.feed(text, fn);
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::aho_corasick::size_type bpstd::aho_corasick::pattern_count()
+  const noexcept
+{
+  return m_pattern_sizes.size();
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::aho_corasick::size_type bpstd::aho_corasick::state_count()
+  const noexcept
+{
+  return m_transitions.size() / m_stride;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+inline
+void bpstd::aho_corasick::build(const std::vector<string_view>& patterns)
+{
+  constexpr auto none = std::numeric_limits<size_type>::max();
+
+  // Each byte that appears in a pattern has its own class, and the bytes
+  // that do not all behave the same, so share the last class
+  auto used = std::vector<bool>(256u, false);
+  for (auto pattern : patterns) {
+    if (pattern.empty()) {
+      throw std::invalid_argument{"bpstd::aho_corasick: empty pattern"};
+    }
+    for (auto c : pattern) {
+      used[static_cast<unsigned char>(c)] = true;
+    }
+  }
+  auto used_count = size_type{0u};
+  for (auto b = 0u; b < 256u; ++b) {
+    used_count += used[b] ? 1u : 0u;
+  }
+  auto stride = size_type{0u};
+  for (auto b = 0u; b < 256u; ++b) {
+    m_byte_classes[b] = static_cast<unsigned char>(used[b] ? stride++ : used_count);
+  }
+  if (used_count < 256u) {
+    ++stride;
+  }
+
+  // Build the trie of the patterns, with 'none' for missing edges
+  auto delta = std::vector<size_type>(stride, none);
+  auto outputs = std::vector<std::vector<size_type>>(1u);
+  m_pattern_sizes.reserve(patterns.size());
+  for (auto i = size_type{0u}; i < patterns.size(); ++i) {
+    auto state = size_type{0u};
+    for (auto c : patterns[i]) {
+      const auto edge = state * stride + m_byte_classes[static_cast<unsigned char>(c)];
+      if (delta[edge] == none) {
+        delta[edge] = outputs.size();
+        outputs.emplace_back();
+        delta.resize(delta.size() + stride, none);
+      }
+      state = delta[edge];
+    }
+    outputs[state].push_back(i);
+    m_pattern_sizes.push_back(patterns[i].size());
+  }
+  const auto count = outputs.size();
+
+  // Complete the trie into an automaton in breadth-first order, so that the
+  // failure state of every state is finished before the state itself.
+  // Missing edges take the edge of the failure state, and each state also
+  // reports the matches of its failure state.
+  auto fail = std::vector<size_type>(count, 0u);
+  auto queue = std::vector<size_type>{};
+  queue.reserve(count);
+  for (auto c = size_type{0u}; c < stride; ++c) {
+    auto& next = delta[c];
+    if (next == none) {
+      next = 0u;
+    } else {
+      queue.push_back(next);
+    }
+  }
+  for (auto i = size_type{0u}; i < queue.size(); ++i) {
+    const auto state = queue[i];
+    const auto& inherited = outputs[fail[state]];
+    outputs[state].insert(outputs[state].end(), inherited.begin(), inherited.end());
+
+    for (auto c = size_type{0u}; c < stride; ++c) {
+      auto& next = delta[state * stride + c];
+      const auto fallback = delta[fail[state] * stride + c];
+      if (next == none) {
+        next = fallback;
+      } else {
+        fail[next] = fallback;
+        queue.push_back(next);
+      }
+    }
+  }
+
+  // Renumber the states so that the ones with matches come last
+  auto order = std::vector<size_type>{};
+  order.reserve(count);
+  for (auto state = size_type{0u}; state < count; ++state) {
+    if (outputs[state].empty()) {
+      order.push_back(state);
+    }
+  }
+  const auto first_match = order.size();
+  for (auto state = size_type{0u}; state < count; ++state) {
+    if (!outputs[state].empty()) {
+      order.push_back(state);
+    }
+  }
+
+  if (count > std::numeric_limits<state_type>::max() / stride) {
+    throw std::length_error{"bpstd::aho_corasick: too many states"};
+  }
+  auto renumbered = std::vector<size_type>(count);
+  for (auto i = size_type{0u}; i < count; ++i) {
+    renumbered[order[i]] = i;
+  }
+
+  m_stride = static_cast<state_type>(stride);
+  m_first_match_state = static_cast<state_type>(first_match * stride);
+  m_transitions.resize(count * stride);
+  for (auto i = size_type{0u}; i < count; ++i) {
+    for (auto c = size_type{0u}; c < stride; ++c) {
+      const auto next = renumbered[delta[order[i] * stride + c]];
+      m_transitions[i * stride + c] = static_cast<state_type>(next * stride);
+    }
+  }
+
+  m_match_first.reserve(count - first_match + 1u);
+  for (auto i = first_match; i < count; ++i) {
+    const auto& matches = outputs[order[i]];
+    m_match_first.push_back(m_matches.size());
+    m_matches.insert(m_matches.end(), matches.begin(), matches.end());
+  }
+  m_match_first.push_back(m_matches.size());
+}
+
+template <typename Fn>
+inline
+void bpstd::aho_corasick::report(state_type state, size_type end, Fn& fn)
+  const
+{
+  const auto index = static_cast<size_type>((state - m_first_match_state) / m_stride);
+  const auto last = m_match_first[index + 1u];
+  for (auto i = m_match_first[index]; i != last; ++i) {
+    const auto pattern = m_matches[i];
+    fn(match{pattern, end - m_pattern_sizes[pattern]});
+  }
+}
+
+//==============================================================================
+// class : aho_corasick::scanner
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::aho_corasick::scanner::scanner(const aho_corasick& matcher)
+  noexcept
+  : m_matcher{&matcher},
+    m_state{0u},
+    m_offset{0u}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Scanning
+//------------------------------------------------------------------------------
+
+template <typename Fn>
+inline
+void bpstd::aho_corasick::scanner::feed(string_view chunk, Fn&& fn)
+{
+  const auto& matcher = *m_matcher;
+  const auto* const transitions = matcher.m_transitions.data();
+  const auto* const classes = matcher.m_byte_classes;
+  const auto first_match = matcher.m_first_match_state;
+
+  auto state = m_state;
+  const auto* const data = chunk.data();
+  const auto size = chunk.size();
+  for (auto i = size_type{0u}; i < size; ++i) {
+    state = transitions[state + classes[static_cast<unsigned char>(data[i])]];
+    if (state >= first_match) {
+      matcher.report(state, m_offset + i + 1u, fn);
+    }
+  }
+  m_state = state;
+  m_offset += size;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::aho_corasick::scanner::reset()
+  noexcept
+{
+  m_state = 0u;
+  m_offset = 0u;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::aho_corasick::size_type bpstd::aho_corasick::scanner::offset()
+  const noexcept
+{
+  return m_offset;
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_AHO_CORASICK_HPP */
@@ -35,11 +35,13 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "detail/config.hpp"
+#include "detail/enable_overload.hpp" // enable_overload_if
 #include "type_traits.hpp"  // enable_if_t, is_*
 #include "utility.hpp"      // in_place_type_t, move, forward
 
 #include <typeinfo>         // std::bad_cast, std::type_info
 #include <initializer_list> // std::initializer_list
+#include <memory>           // std::allocator_arg_t, std::allocator_traits
 #include <new>              // placement-new
 #include <cassert>          // assert
 
@@ -47,7 +49,35 @@ BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
 namespace bpstd {
 
-  class any;
+  template <std::size_t Size, std::size_t Align, bool Copyable = true>
+  class basic_any;
+
+  /// \brief The default 'any' type, which is able to store objects of up to
+  ///        4 pointers in size without allocating
+  using any = basic_any<4u * sizeof(void*), alignof(void*)>;
+
+  /// \brief A move-only 'any', which is able to store move-only types
+  template <std::size_t Size, std::size_t Align>
+  using basic_unique_any = basic_any<Size, Align, false>;
+
+  /// \brief The default move-only 'any' type, which is able to store objects
+  ///        of up to 4 pointers in size without allocating
+  using unique_any = basic_unique_any<4u * sizeof(void*), alignof(void*)>;
+
+  namespace detail {
+
+    /// \brief A unique object per type, whose address identifies the type of
+    ///        the value stored in an any without requiring RTTI
+    template <typename T>
+    struct any_type_tag
+    {
+      static const char id;
+    };
+
+    template <typename T>
+    const char any_type_tag<T>::id = 0;
+
+  } // namespace detail
 
   //============================================================================
   // class : bad_any_cast
@@ -59,7 +89,7 @@ namespace bpstd {
   };
 
   //============================================================================
-  // class : any
+  // class : basic_any
   //============================================================================
 
   //////////////////////////////////////////////////////////////////////////////
@@ -79,38 +109,62 @@ namespace bpstd {
   /// contained object.
   ///
   /// This implementation uses small-buffer optimization to avoid dynamic
-  /// memory if the object is below a (4 * sizeof(void*))
+  /// memory if the object fits within \p Size bytes, is aligned to no more
+  /// than \p Align, and is nothrow move-constructible.
+  ///
+  /// If \p Copyable is \c false, the any is move-only and is able to hold
+  /// move-only types. The copy operation is then never instantiated for any
+  /// stored type.
+  ///
+  /// \tparam Size the size of the internal buffer
+  /// \tparam Align the alignment of the internal buffer
+  /// \tparam Copyable whether the any, and the values it holds, are copyable
   //////////////////////////////////////////////////////////////////////////////
-  class any
+  template <std::size_t Size, std::size_t Align, bool Copyable>
+  class basic_any
   {
+    static_assert(
+      Align != 0u && (Align & (Align - 1u)) == 0u,
+      "Align must be a power of two"
+    );
+
+    // trait to determine if a type is able to be stored in this any
+    template<typename T>
+    using is_storable = bool_constant<
+      Copyable ? is_copy_constructible<T>::value
+               : is_move_constructible<T>::value
+    >;
+
     //--------------------------------------------------------------------------
     // Constructors / Destructor / Assignment
     //--------------------------------------------------------------------------
   public:
 
     /// \brief Constructs an any instance that does not contain any value
-    any() noexcept;
+    basic_any() noexcept;
 
     /// \brief Moves an any instance by moving the stored underlying value
     ///
     /// \post \p other is left valueless
     ///
     /// \param other the other instance to move
-    any(any&& other) noexcept;
+    basic_any(basic_any&& other) noexcept;
 
     /// \brief Copies an any instance by copying the stored underlying value
     ///
+    /// \note This constructor is only available if \p Copyable is \c true
+    ///
     /// \param other the other instance to copy
-    any(const any& other);
+    basic_any(detail::enable_overload_if_t<Copyable,const basic_any&> other);
 
     /// \brief Constructs this any using \p value for the underlying instance
     ///
     /// \param value the value to construct this any out of
     template<typename ValueType,
-             typename=enable_if_t<!is_same<decay_t<ValueType>,any>::value &&
-                                   is_copy_constructible<decay_t<ValueType>>::value>>
+             typename=enable_if_t<!is_same<decay_t<ValueType>,basic_any>::value &&
+                                   is_storable<decay_t<ValueType>>::value>>
     // cppcheck-suppress noExplicitConstructor
-    any(ValueType&& value);
+    basic_any(ValueType&& value);
 
     /// \brief Constructs an 'any' of type ValueType by forwarding \p args to
     ///        its constructor
@@ -121,8 +175,8 @@ namespace bpstd {
     /// \param args the arguments to forward to ValueType's constructor
     template<typename ValueType, typename...Args,
              typename=enable_if_t<is_constructible<decay_t<ValueType>,Args...>::value &&
-                                  is_copy_constructible<decay_t<ValueType>>::value>>
-    explicit any(in_place_type_t<ValueType>, Args&&...args);
+                                  is_storable<decay_t<ValueType>>::value>>
+    explicit basic_any(in_place_type_t<ValueType>, Args&&...args);
 
     /// \brief Constructs an 'any' of type ValueType by forwarding \p args to
     ///        its constructor
@@ -134,14 +188,47 @@ namespace bpstd {
     /// \param args the arguments to forward to ValueType's constructor
     template<typename ValueType, typename U, typename...Args,
              typename=enable_if_t<is_constructible<decay_t<ValueType>,std::initializer_list<U>,Args...>::value &&
-                                  is_copy_constructible<decay_t<ValueType>>::value>>
-    explicit any(in_place_type_t<ValueType>,
-                 std::initializer_list<U> il,
-                 Args&&...args);
+                                  is_storable<decay_t<ValueType>>::value>>
+    explicit basic_any(in_place_type_t<ValueType>,
+                       std::initializer_list<U> il,
+                       Args&&...args);
+
+    /// \brief Constructs this any using \p value for the underlying instance
+    ///
+    /// If \p value does not fit within the internal buffer, its storage is
+    /// allocated with \p alloc. Copies of this any allocate with a copy of
+    /// \p alloc.
+    ///
+    /// \param alloc the allocator to use for external storage
+    /// \param value the value to construct this any out of
+    template<typename Allocator, typename ValueType,
+             typename=enable_if_t<!is_same<decay_t<ValueType>,basic_any>::value &&
+                                   is_storable<decay_t<ValueType>>::value>>
+    basic_any(std::allocator_arg_t, const Allocator& alloc, ValueType&& value);
+
+    /// \brief Constructs an 'any' of type ValueType by forwarding \p args to
+    ///        its constructor
+    ///
+    /// If ValueType does not fit within the internal buffer, its storage is
+    /// allocated with \p alloc. Copies of this any allocate with a copy of
+    /// \p alloc.
+    ///
+    /// \note This constructor only participates in overload resolution if
+    ///       ValueType is constructible from \p args
+    ///
+    /// \param alloc the allocator to use for external storage
+    /// \param args the arguments to forward to ValueType's constructor
+    template<typename ValueType, typename Allocator, typename...Args,
+             typename=enable_if_t<is_constructible<decay_t<ValueType>,Args...>::value &&
+                                  is_storable<decay_t<ValueType>>::value>>
+    explicit basic_any(std::allocator_arg_t,
+                       const Allocator& alloc,
+                       in_place_type_t<ValueType>,
+                       Args&&...args);
 
     //--------------------------------------------------------------------------
 
-    ~any();
+    ~basic_any();
 
     //--------------------------------------------------------------------------
 
@@ -149,22 +236,24 @@ namespace bpstd {
     ///
     /// \param other the other any to move
     /// \return reference to \c (*this)
-    any& operator=(any&& other) noexcept;
+    basic_any& operator=(basic_any&& other) noexcept;
 
     /// \brief Assigns the contents of \p other to this any
     ///
+    /// \note This operator is only available if \p Copyable is \c true
+    ///
     /// \param other the other any to copy
     /// \return reference to \c (*this)
-    any& operator=(const any& other);
+    basic_any& operator=(detail::enable_overload_if_t<Copyable,const basic_any&> other);
 
     /// \brief Assigns \p value to this any
     ///
     /// \param value the value to assign
     /// \return reference to \c (*this)
     template<typename ValueType,
-             typename=enable_if_t<!is_same<decay_t<ValueType>,any>::value &&
-                                   is_copy_constructible<decay_t<ValueType>>::value>>
-    any& operator=(ValueType&& value);
+             typename=enable_if_t<!is_same<decay_t<ValueType>,basic_any>::value &&
+                                   is_storable<decay_t<ValueType>>::value>>
+    basic_any& operator=(ValueType&& value);
 
     //--------------------------------------------------------------------------
     // Modifiers
@@ -180,11 +269,11 @@ namespace bpstd {
     /// \return reference to the constructed value
     template<typename ValueType, typename...Args,
               typename=enable_if_t<is_constructible<decay_t<ValueType>,Args...>::value &&
-                                   is_copy_constructible<decay_t<ValueType>>::value>>
+                                   is_storable<decay_t<ValueType>>::value>>
     decay_t<ValueType>& emplace(Args&&...args);
     template<typename ValueType, typename U, typename...Args,
               typename=enable_if_t<is_constructible<decay_t<ValueType>,std::initializer_list<U>,Args...>::value &&
-                                   is_copy_constructible<decay_t<ValueType>>::value>>
+                                   is_storable<decay_t<ValueType>>::value>>
     decay_t<ValueType>& emplace(std::initializer_list<U> il, Args&&...args );
     /// \}
 
@@ -198,7 +287,7 @@ namespace bpstd {
     ///       contains the old contents of \p other
     ///
     /// \param other the other any to swap contents with
-    void swap(any& other) noexcept;
+    void swap(basic_any& other) noexcept;
 
     //--------------------------------------------------------------------------
     // Observers
@@ -210,11 +299,15 @@ namespace bpstd {
     /// \return \c true if this contains a value
     bool has_value() const noexcept;
 
+#if BPSTD_HAS_RTTI
     /// \brief Gets the type_info for the underlying stored type, or
     ///        \c typeid(void) if \ref has_value() returns \c false
     ///
+    /// \note This function is only available when RTTI is enabled
+    ///
     /// \return the typeid of the stored type
     const std::type_info& type() const noexcept;
+#endif
 
     //--------------------------------------------------------------------------
     // Private Static Members / Types
@@ -222,8 +315,8 @@ namespace bpstd {
   private:
 
     // Internal buffer size + alignment
-    static constexpr auto buffer_size  = 4u * sizeof(void*);
-    static constexpr auto buffer_align = alignof(void*);
+    static constexpr auto buffer_size  = Size;
+    static constexpr auto buffer_align = Align;
 
     // buffer (for internal storage)
     using internal_buffer = typename aligned_storage<buffer_size,buffer_align>::type;
@@ -259,6 +352,28 @@ namespace bpstd {
       external_storage_handler<T>
     >;
 
+    template<typename T, typename Allocator>
+    struct allocator_storage_handler;
+
+    template<typename T, typename Allocator>
+    using allocated_storage_handler = conditional_t<
+      requires_internal_storage<T>::value,
+      internal_storage_handler<T>,
+      allocator_storage_handler<T,Allocator>
+    >;
+
+    /// \{
+    /// \brief Copies the value in \p other into \p self with \p Handler,
+    ///        if this any is copyable
+    ///
+    /// This prevents instantiating the copy operation of handlers for
+    /// move-only anys, which may hold move-only types.
+    template<typename Handler>
+    static void copy_with(storage& self, const storage& other, true_type);
+    template<typename Handler>
+    static void copy_with(storage& self, const storage& other, false_type);
+    /// \}
+
     //-----------------------------------------------------------------------
 
     enum class operation
@@ -267,17 +382,55 @@ namespace bpstd {
       copy,    ///< Operation for copying the underlying value
       move,    ///< Operation for moving the underlying value
       value,   ///< Operation for accessing the underlying value
+      identity,///< Operation for accessing the underlying type's tag
+#if BPSTD_HAS_RTTI
       type,    ///< Operation for accessing the underlying type
+#endif
     };
 
     //-----------------------------------------------------------------------
 
     using storage_handler_ptr = const void*(*)(operation, const storage*,const storage*);
 
-    template<typename T>
-    friend T* any_cast(any*) noexcept;
-    template<typename T>
-    friend const T* any_cast(const any*) noexcept;
+    //-----------------------------------------------------------------------
+    // Private Member Functions
+    //-----------------------------------------------------------------------
+  private:
+
+    /// \brief Checks whether this any contains an object of type \p T
+    ///
+    /// The storage handler uniquely identifies the stored type, so this is a
+    /// single pointer comparison. Handlers are not guaranteed to be unique
+    /// across shared-library boundaries, so if RTTI is available this falls
+    /// back to comparing the type_info on a mismatch.
+    ///
+    /// \tparam T the type to check for
+    /// \return \c true if this contains a \p T
+    template <typename T>
+    bool is_holding() const noexcept;
+    template <typename T>
+    bool is_holding(true_type) const noexcept;
+    template <typename T>
+    bool is_holding(false_type) const noexcept;
+
+    /// \{
+    /// \brief Constructs a \p T from \p args, using \p alloc to allocate
+    ///        storage if it is not stored internally
+    ///
+    /// \param alloc the allocator
+    /// \param args the arguments to forward to \p T's constructor
+    template <typename T, typename Allocator, typename...Args>
+    void construct_allocated(true_type, const Allocator& alloc, Args&&...args);
+    template <typename T, typename Allocator, typename...Args>
+    void construct_allocated(false_type, const Allocator& alloc, Args&&...args);
+    /// \}
+
+    //-----------------------------------------------------------------------
+
+    template<typename T, std::size_t USize, std::size_t UAlign, bool UCopyable>
+    friend T* any_cast(basic_any<USize,UAlign,UCopyable>*) noexcept;
+    template<typename T, std::size_t USize, std::size_t UAlign, bool UCopyable>
+    friend const T* any_cast(const basic_any<USize,UAlign,UCopyable>*) noexcept;
 
     //-----------------------------------------------------------------------
     // Private Members
@@ -289,7 +442,7 @@ namespace bpstd {
   };
 
   //=========================================================================
-  // non-member functions : class : any
+  // non-member functions : class : basic_any
   //=========================================================================
 
   //-------------------------------------------------------------------------
@@ -297,7 +450,8 @@ namespace bpstd {
   //-------------------------------------------------------------------------
 
   /// \brief Swaps the contents of \p lhs and \p rhs
-  void swap(any& lhs, any& rhs) noexcept;
+  template <std::size_t Size, std::size_t Align, bool Copyable>
+  void swap(basic_any<Size,Align,Copyable>& lhs, basic_any<Size,Align,Copyable>& rhs) noexcept;
 
   //-------------------------------------------------------------------------
   // casts
@@ -309,12 +463,12 @@ namespace bpstd {
   /// \throw bad_any_cast if \p any is not exactly of type \p T
   /// \tparam T the type to cast to
   /// \return the object
-  template<typename T>
-  T any_cast(any& operand);
-  template<typename T>
-  T any_cast(any&& operand);
-  template<typename T>
-  T any_cast(const any& operand);
+  template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
+  T any_cast(basic_any<Size,Align,Copyable>& operand);
+  template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
+  T any_cast(basic_any<Size,Align,Copyable>&& operand);
+  template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
+  T any_cast(const basic_any<Size,Align,Copyable>& operand);
   /// \}
 
   /// \{
@@ -322,10 +476,10 @@ namespace bpstd {
   ///
   /// \tparam T the type to cast to
   /// \return pointer to the object if successfull, nullptr otherwise
-  template<typename T>
-  T* any_cast(any* operand) noexcept;
-  template<typename T>
-  const T* any_cast(const any* operand) noexcept;
+  template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
+  T* any_cast(basic_any<Size,Align,Copyable>* operand) noexcept;
+  template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
+  const T* any_cast(const basic_any<Size,Align,Copyable>* operand) noexcept;
   /// \}
 
 } // namespace bpstd
@@ -342,11 +496,12 @@ const char* bpstd::bad_any_cast::what()
 }
 
 //=============================================================================
-// class : any::internal_storage_handler
+// class : basic_any::internal_storage_handler
 //=============================================================================
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
-struct bpstd::any::internal_storage_handler
+struct bpstd::basic_any<Size,Align,Copyable>::internal_storage_handler
 {
   template<typename...Args>
   static T* construct(storage& s, Args&&...args);
@@ -356,45 +511,62 @@ struct bpstd::any::internal_storage_handler
 
   static void destroy(storage& s);
 
+  static void copy(storage& self, const storage& other);
+
   static const void* handle(operation op,
                             const storage* self,
                             const storage* other);
 };
 
 //=============================================================================
-// definition : class : any::internal_storage_handler
+// definition : class : basic_any::internal_storage_handler
 //=============================================================================
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 template<typename...Args>
 inline BPSTD_INLINE_VISIBILITY
-T* bpstd::any::internal_storage_handler<T>
+T* bpstd::basic_any<Size,Align,Copyable>::internal_storage_handler<T>
   ::construct(storage& s, Args&&...args)
 {
   return ::new(&s.internal) T(bpstd::forward<Args>(args)...);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 template<typename U, typename...Args>
 inline BPSTD_INLINE_VISIBILITY
-T* bpstd::any::internal_storage_handler<T>
+T* bpstd::basic_any<Size,Align,Copyable>::internal_storage_handler<T>
   ::construct(storage& s, std::initializer_list<U> il, Args&&...args)
 {
   return ::new(&s.internal) T(il, bpstd::forward<Args>(args)...);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 inline BPSTD_INLINE_VISIBILITY
-void bpstd::any::internal_storage_handler<T>
+void bpstd::basic_any<Size,Align,Copyable>::internal_storage_handler<T>
   ::destroy(storage& s)
 {
   auto* t = static_cast<T*>(static_cast<void*>(&s.internal));
   t->~T();
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 inline BPSTD_INLINE_VISIBILITY
-const void* bpstd::any::internal_storage_handler<T>
+void bpstd::basic_any<Size,Align,Copyable>::internal_storage_handler<T>
+  ::copy(storage& self, const storage& other)
+{
+  // Copy construct from the internal storage
+  const auto* p = reinterpret_cast<const T*>(&other.internal);
+  construct(self, *p);
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T>
+inline BPSTD_INLINE_VISIBILITY
+const void* bpstd::basic_any<Size,Align,Copyable>::internal_storage_handler<T>
   ::handle(operation op,
            const storage* self,
            const storage* other)
@@ -415,9 +587,9 @@ const void* bpstd::any::internal_storage_handler<T>
       assert(self != nullptr);
       assert(other != nullptr);
 
-      // Copy construct from the internal storage
-      const auto* p = reinterpret_cast<const T*>(&other->internal);
-      construct( const_cast<storage&>(*self), *p);
+      copy_with<internal_storage_handler>(const_cast<storage&>(*self),
+                                          *other,
+                                          bool_constant<Copyable>{});
       break;
     }
 
@@ -446,6 +618,15 @@ const void* bpstd::any::internal_storage_handler<T>
       return static_cast<const void*>(p);
     }
 
+    case operation::identity:
+    {
+      BPSTD_UNUSED(self);
+      BPSTD_UNUSED(other);
+
+      return &detail::any_type_tag<T>::id;
+    }
+
+#if BPSTD_HAS_RTTI
     case operation::type:
     {
       BPSTD_UNUSED(self);
@@ -453,16 +634,18 @@ const void* bpstd::any::internal_storage_handler<T>
 
       return static_cast<const void*>(&typeid(T));
     }
+#endif
   }
   return nullptr;
 }
 
 //=============================================================================
-// class : any::external_storage_handler
+// class : basic_any::external_storage_handler
 //=============================================================================
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
-struct bpstd::any::external_storage_handler
+struct bpstd::basic_any<Size,Align,Copyable>::external_storage_handler
 {
   template<typename...Args>
   static T* construct(storage& s, Args&&...args);
@@ -472,6 +655,8 @@ struct bpstd::any::external_storage_handler
 
   static void destroy(storage& s);
 
+  static void copy(storage& self, const storage& other);
+
   static const void* handle(operation op,
                             const storage* self,
                             const storage* other);
@@ -479,40 +664,55 @@ struct bpstd::any::external_storage_handler
 
 
 //=============================================================================
-// definition : class : any::external_storage_handler
+// definition : class : basic_any::external_storage_handler
 //=============================================================================
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 template<typename...Args>
 inline BPSTD_INLINE_VISIBILITY
-T* bpstd::any::external_storage_handler<T>
+T* bpstd::basic_any<Size,Align,Copyable>::external_storage_handler<T>
   ::construct(storage& s, Args&&...args)
 {
   s.external = new T(bpstd::forward<Args>(args)...);
   return static_cast<T*>(s.external);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 template<typename U, typename...Args>
 inline BPSTD_INLINE_VISIBILITY
-T* bpstd::any::external_storage_handler<T>
+T* bpstd::basic_any<Size,Align,Copyable>::external_storage_handler<T>
   ::construct(storage& s, std::initializer_list<U> il, Args&&...args)
 {
   s.external = new T(il, bpstd::forward<Args>(args)...);
   return static_cast<T*>(s.external);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 inline BPSTD_INLINE_VISIBILITY
-void bpstd::any::external_storage_handler<T>
+void bpstd::basic_any<Size,Align,Copyable>::external_storage_handler<T>
   ::destroy(storage& s)
 {
+  // This is null if the value was transferred away by a move
   delete static_cast<T*>(s.external);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::external_storage_handler<T>
+  ::copy(storage& self, const storage& other)
+{
+  // Copy construct from the external storage
+  construct(self, *static_cast<const T*>(other.external));
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename T>
 inline BPSTD_INLINE_VISIBILITY
-const void* bpstd::any::external_storage_handler<T>
+const void* bpstd::basic_any<Size,Align,Copyable>::external_storage_handler<T>
   ::handle( operation op,
             const storage* self,
             const storage* other )
@@ -533,20 +733,22 @@ const void* bpstd::any::external_storage_handler<T>
       assert(self != nullptr);
       assert(other != nullptr);
 
-      // Copy construct from the internal storage
-      construct( const_cast<storage&>(*self),
-                 *static_cast<const T*>(other->external));
+      copy_with<external_storage_handler>(const_cast<storage&>(*self),
+                                          *other,
+                                          bool_constant<Copyable>{});
       break;
     }
 
     case operation::move:
     {
-      BPSTD_UNUSED(self != nullptr);
+      assert(self != nullptr);
       assert(other != nullptr);
 
-      const auto p = static_cast<const T*>(other->external);
-      // Move construct from the internal storage. '
-      construct(const_cast<storage&>(*self), bpstd::move(*const_cast<T*>(p)));
+      // Transfer ownership of the external storage, leaving the source with
+      // nothing to destroy
+      auto& source = const_cast<storage&>(*other);
+      const_cast<storage&>(*self).external = source.external;
+      source.external = nullptr;
       break;
     }
 
@@ -560,6 +762,188 @@ const void* bpstd::any::external_storage_handler<T>
       return self->external;
     }
 
+    case operation::identity:
+    {
+      BPSTD_UNUSED(self);
+      BPSTD_UNUSED(other);
+
+      return &detail::any_type_tag<T>::id;
+    }
+
+#if BPSTD_HAS_RTTI
+    case operation::type:
+    {
+      BPSTD_UNUSED(self);
+      BPSTD_UNUSED(other);
+
+      return &typeid(T);
+    }
+#endif
+  }
+  return nullptr;
+}
+
+//=============================================================================
+// class : basic_any::allocator_storage_handler
+//=============================================================================
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T, typename Allocator>
+struct bpstd::basic_any<Size,Align,Copyable>::allocator_storage_handler
+{
+  struct node;
+
+  using allocator_type = typename std::allocator_traits<Allocator>
+    ::template rebind_alloc<node>;
+  using traits_type    = std::allocator_traits<allocator_type>;
+
+  // The allocator is stored alongside the value, so that the value can be
+  // copied and destroyed through the type-erased handler
+  struct node
+  {
+    template<typename...Args>
+    node(const allocator_type& alloc, Args&&...args);
+
+    allocator_type allocator;
+    T              value;
+  };
+
+  template<typename...Args>
+  static T* construct(storage& s, const allocator_type& alloc, Args&&...args);
+
+  static void destroy(storage& s);
+
+  static void copy(storage& self, const storage& other);
+
+  static const void* handle(operation op,
+                            const storage* self,
+                            const storage* other);
+};
+
+//=============================================================================
+// definition : class : basic_any::allocator_storage_handler
+//=============================================================================
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T, typename Allocator>
+template<typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_any<Size,Align,Copyable>::allocator_storage_handler<T,Allocator>::node
+  ::node(const allocator_type& alloc, Args&&...args)
+  : allocator(alloc),
+    value(bpstd::forward<Args>(args)...)
+{
+
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T, typename Allocator>
+template<typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+T* bpstd::basic_any<Size,Align,Copyable>::allocator_storage_handler<T,Allocator>
+  ::construct(storage& s, const allocator_type& alloc, Args&&...args)
+{
+  auto allocator = alloc;
+  auto* p = traits_type::allocate(allocator, 1u);
+
+  try {
+    traits_type::construct(allocator, p, alloc, bpstd::forward<Args>(args)...);
+  } catch (...) {
+    traits_type::deallocate(allocator, p, 1u);
+    throw;
+  }
+  s.external = p;
+  return &p->value;
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T, typename Allocator>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::allocator_storage_handler<T,Allocator>
+  ::destroy(storage& s)
+{
+  // The node is null if it was transferred away by a move
+  auto* p = static_cast<node*>(s.external);
+  if (p == nullptr) {
+    return;
+  }
+  auto allocator = p->allocator;
+
+  traits_type::destroy(allocator, p);
+  traits_type::deallocate(allocator, p, 1u);
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T, typename Allocator>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::allocator_storage_handler<T,Allocator>
+  ::copy(storage& self, const storage& other)
+{
+  // Copy construct with a copy of the original allocator
+  const auto* p = static_cast<const node*>(other.external);
+  construct(self, p->allocator, p->value);
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename T, typename Allocator>
+inline BPSTD_INLINE_VISIBILITY
+const void* bpstd::basic_any<Size,Align,Copyable>::allocator_storage_handler<T,Allocator>
+  ::handle(operation op,
+           const storage* self,
+           const storage* other)
+{
+  switch (op)
+  {
+    case operation::destroy:
+    {
+      assert(self != nullptr);
+      BPSTD_UNUSED(other);
+
+      destroy(const_cast<storage&>(*self));
+      break;
+    }
+
+    case operation::copy:
+    {
+      assert(self != nullptr);
+      assert(other != nullptr);
+
+      copy_with<allocator_storage_handler>(const_cast<storage&>(*self),
+                                           *other,
+                                           bool_constant<Copyable>{});
+      break;
+    }
+
+    case operation::move:
+    {
+      assert(self != nullptr);
+      assert(other != nullptr);
+
+      // Transfer ownership of the node, so that moving never allocates
+      auto& source = const_cast<storage&>(*other);
+      const_cast<storage&>(*self).external = source.external;
+      source.external = nullptr;
+      break;
+    }
+
+    case operation::value:
+    {
+      assert(self != nullptr);
+      BPSTD_UNUSED(other);
+
+      const auto* p = static_cast<const node*>(self->external);
+      return static_cast<const void*>(&p->value);
+    }
+
+    case operation::identity:
+    {
+      BPSTD_UNUSED(self);
+      BPSTD_UNUSED(other);
+
+      return &detail::any_type_tag<T>::id;
+    }
+
+#if BPSTD_HAS_RTTI
     case operation::type:
     {
       BPSTD_UNUSED(self);
@@ -567,20 +951,22 @@ const void* bpstd::any::external_storage_handler<T>
 
       return &typeid(T);
     }
+#endif
   }
   return nullptr;
 }
 
 //=============================================================================
-// definitions : class : any
+// definitions : class : basic_any
 //=============================================================================
 
 //-----------------------------------------------------------------------------
 // Constructors / Destructor / Assignment
 //-----------------------------------------------------------------------------
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::any()
+bpstd::basic_any<Size,Align,Copyable>::basic_any()
   noexcept
   : m_storage{},
     m_storage_handler{nullptr}
@@ -588,19 +974,23 @@ bpstd::any::any()
 
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::any(any&& other)
+bpstd::basic_any<Size,Align,Copyable>::basic_any(basic_any&& other)
   noexcept
   : m_storage{},
     m_storage_handler{other.m_storage_handler}
 {
   if (m_storage_handler != nullptr) {
     m_storage_handler(operation::move, &m_storage, &other.m_storage);
+    other.reset();
   }
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::any(const any& other)
+bpstd::basic_any<Size,Align,Copyable>
+  ::basic_any(detail::enable_overload_if_t<Copyable,const basic_any&> other)
   : m_storage{},
     m_storage_handler{nullptr}
 {
@@ -614,9 +1004,10 @@ bpstd::any::any(const any& other)
   }
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename ValueType, typename>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::any(ValueType&& value)
+bpstd::basic_any<Size,Align,Copyable>::basic_any(ValueType&& value)
   : m_storage{},
     m_storage_handler{nullptr}
 {
@@ -627,9 +1018,10 @@ bpstd::any::any(ValueType&& value)
   m_storage_handler = &handler_type::handle;
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename ValueType, typename...Args, typename>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::any(in_place_type_t<ValueType>, Args&&...args)
+bpstd::basic_any<Size,Align,Copyable>::basic_any(in_place_type_t<ValueType>, Args&&...args)
   : m_storage{},
     m_storage_handler{nullptr}
 {
@@ -640,11 +1032,12 @@ bpstd::any::any(in_place_type_t<ValueType>, Args&&...args)
   m_storage_handler = &handler_type::handle;
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename ValueType, typename U, typename...Args, typename>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::any(in_place_type_t<ValueType>,
-                       std::initializer_list<U> il,
-                       Args&&...args)
+bpstd::basic_any<Size,Align,Copyable>::basic_any(in_place_type_t<ValueType>,
+                                        std::initializer_list<U> il,
+                                        Args&&...args)
   : m_storage{},
     m_storage_handler{nullptr}
 {
@@ -655,18 +1048,59 @@ bpstd::any::any(in_place_type_t<ValueType>,
   m_storage_handler = &handler_type::handle;
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename Allocator, typename ValueType, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_any<Size,Align,Copyable>::basic_any(std::allocator_arg_t,
+                                        const Allocator& alloc,
+                                        ValueType&& value)
+  : basic_any{
+      std::allocator_arg,
+      alloc,
+      in_place_type_t<decay_t<ValueType>>{},
+      bpstd::forward<ValueType>(value)
+    }
+{
+
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template<typename ValueType, typename Allocator, typename...Args, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_any<Size,Align,Copyable>::basic_any(std::allocator_arg_t,
+                                        const Allocator& alloc,
+                                        in_place_type_t<ValueType>,
+                                        Args&&...args)
+  : m_storage{},
+    m_storage_handler{nullptr}
+{
+  using value_type   = decay_t<ValueType>;
+  using handler_type = allocated_storage_handler<value_type,Allocator>;
+
+  // Set handler after constructing, in case of exception
+  construct_allocated<value_type>(
+    requires_internal_storage<value_type>{},
+    alloc,
+    bpstd::forward<Args>(args)...
+  );
+  m_storage_handler = &handler_type::handle;
+}
+
 //-----------------------------------------------------------------------------
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any::~any()
+bpstd::basic_any<Size,Align,Copyable>::~basic_any()
 {
   reset();
 }
 
 //-----------------------------------------------------------------------------
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any& bpstd::any::operator=(any&& other)
+bpstd::basic_any<Size,Align,Copyable>&
+  bpstd::basic_any<Size,Align,Copyable>::operator=(basic_any&& other)
   noexcept
 {
   reset();
@@ -674,13 +1108,17 @@ bpstd::any& bpstd::any::operator=(any&& other)
   if (other.m_storage_handler != nullptr) {
     m_storage_handler = other.m_storage_handler;
     m_storage_handler(operation::move, &m_storage, &other.m_storage);
+    other.reset();
   }
 
   return (*this);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any& bpstd::any::operator=(const any& other)
+bpstd::basic_any<Size,Align,Copyable>&
+  bpstd::basic_any<Size,Align,Copyable>
+  ::operator=(detail::enable_overload_if_t<Copyable,const basic_any&> other)
 {
   reset();
 
@@ -695,9 +1133,11 @@ bpstd::any& bpstd::any::operator=(const any& other)
   return (*this);
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename ValueType, typename>
 inline BPSTD_INLINE_VISIBILITY
-bpstd::any& bpstd::any::operator=(ValueType&& value)
+bpstd::basic_any<Size,Align,Copyable>&
+  bpstd::basic_any<Size,Align,Copyable>::operator=(ValueType&& value)
 {
   using handler_type = storage_handler<decay_t<ValueType>>;
 
@@ -713,10 +1153,11 @@ bpstd::any& bpstd::any::operator=(ValueType&& value)
 // Modifiers
 //-----------------------------------------------------------------------------
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename ValueType, typename...Args, typename>
 inline BPSTD_INLINE_VISIBILITY
 bpstd::decay_t<ValueType>&
-  bpstd::any::emplace(Args&&...args)
+  bpstd::basic_any<Size,Align,Copyable>::emplace(Args&&...args)
 {
   using handler_type = storage_handler<decay_t<ValueType>>;
 
@@ -729,11 +1170,12 @@ bpstd::decay_t<ValueType>&
   return result;
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 template<typename ValueType, typename U, typename...Args, typename>
 inline BPSTD_INLINE_VISIBILITY
 bpstd::decay_t<ValueType>&
-  bpstd::any::emplace(std::initializer_list<U> il,
-                      Args&&...args)
+  bpstd::basic_any<Size,Align,Copyable>::emplace(std::initializer_list<U> il,
+                                        Args&&...args)
 {
   using handler_type = storage_handler<decay_t<ValueType>>;
 
@@ -747,8 +1189,9 @@ bpstd::decay_t<ValueType>&
   return result;
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-void bpstd::any::reset()
+void bpstd::basic_any<Size,Align,Copyable>::reset()
   noexcept
 {
   if (m_storage_handler != nullptr) {
@@ -757,15 +1200,16 @@ void bpstd::any::reset()
   }
 }
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-void bpstd::any::swap(any& other)
+void bpstd::basic_any<Size,Align,Copyable>::swap(basic_any& other)
   noexcept
 {
   using std::swap;
 
   if (m_storage_handler != nullptr && other.m_storage_handler != nullptr)
   {
-    auto tmp = any{};
+    auto tmp = basic_any{};
 
     // tmp := self
     tmp.m_storage_handler = m_storage_handler;
@@ -803,15 +1247,18 @@ void bpstd::any::swap(any& other)
 // Observers
 //-----------------------------------------------------------------------------
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-bool bpstd::any::has_value()
+bool bpstd::basic_any<Size,Align,Copyable>::has_value()
   const noexcept
 {
   return m_storage_handler != nullptr;
 }
 
+#if BPSTD_HAS_RTTI
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-const std::type_info& bpstd::any::type()
+const std::type_info& bpstd::basic_any<Size,Align,Copyable>::type()
   const noexcept
 {
   if (has_value()) {
@@ -820,17 +1267,117 @@ const std::type_info& bpstd::any::type()
   }
   return typeid(void);
 }
+#endif
+
+//-----------------------------------------------------------------------------
+// Private Member Functions
+//-----------------------------------------------------------------------------
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename Handler>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::copy_with(storage& self,
+                                                      const storage& other,
+                                                      true_type)
+{
+  Handler::copy(self, other);
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename Handler>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::copy_with(storage& self,
+                                                      const storage& other,
+                                                      false_type)
+{
+  // unreachable; move-only anys never request a copy
+  BPSTD_UNUSED(self);
+  BPSTD_UNUSED(other);
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::basic_any<Size,Align,Copyable>::is_holding()
+  const noexcept
+{
+  // Only types satisfying 'is_storable' can be held (copyable types for 'any',
+  // movable types for 'unique_any'), so this avoids instantiating handlers
+  // for types that could never be held
+  return is_holding<remove_cv_t<T>>(is_storable<remove_cv_t<T>>{});
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::basic_any<Size,Align,Copyable>::is_holding(true_type)
+  const noexcept
+{
+  if (m_storage_handler == &storage_handler<T>::handle) {
+    return true;
+  }
+  if (!has_value()) {
+    return false;
+  }
+  // Values constructed with an allocator use a different handler
+  const auto* tag = m_storage_handler(operation::identity, nullptr, nullptr);
+  if (tag == &detail::any_type_tag<T>::id) {
+    return true;
+  }
+#if BPSTD_HAS_RTTI
+  return type() == typeid(T);
+#else
+  return false;
+#endif
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::basic_any<Size,Align,Copyable>::is_holding(false_type)
+  const noexcept
+{
+  return false;
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename T, typename Allocator, typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::construct_allocated(true_type,
+                                                       const Allocator& alloc,
+                                                       Args&&...args)
+{
+  BPSTD_UNUSED(alloc);
+
+  internal_storage_handler<T>::construct(m_storage, bpstd::forward<Args>(args)...);
+}
+
+template <std::size_t Size, std::size_t Align, bool Copyable>
+template <typename T, typename Allocator, typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_any<Size,Align,Copyable>::construct_allocated(false_type,
+                                                       const Allocator& alloc,
+                                                       Args&&...args)
+{
+  using handler_type   = allocator_storage_handler<T,Allocator>;
+  using allocator_type = typename handler_type::allocator_type;
+
+  handler_type::construct(m_storage,
+                          allocator_type(alloc),
+                          bpstd::forward<Args>(args)...);
+}
 
 //=============================================================================
-// definition : non-member functions : class : any
+// definition : non-member functions : class : basic_any
 //=============================================================================
 
 //-----------------------------------------------------------------------------
 // utilities
 //-----------------------------------------------------------------------------
 
+template <std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-void bpstd::swap(any& lhs, any& rhs)
+void bpstd::swap(basic_any<Size,Align,Copyable>& lhs, basic_any<Size,Align,Copyable>& rhs)
   noexcept
 {
   lhs.swap(rhs);
@@ -840,9 +1387,9 @@ void bpstd::swap(any& lhs, any& rhs)
 // casts
 //-----------------------------------------------------------------------------
 
-template<typename T>
+template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-T bpstd::any_cast(any& operand)
+T bpstd::any_cast(basic_any<Size,Align,Copyable>& operand)
 {
   using underlying_type = remove_cvref_t<T>;
 
@@ -858,9 +1405,9 @@ T bpstd::any_cast(any& operand)
   return static_cast<T>(*p);
 }
 
-template<typename T>
+template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-T bpstd::any_cast(any&& operand)
+T bpstd::any_cast(basic_any<Size,Align,Copyable>&& operand)
 {
   using underlying_type = remove_cvref_t<T>;
 
@@ -876,9 +1423,9 @@ T bpstd::any_cast(any&& operand)
   return static_cast<T>(bpstd::move(*p));
 }
 
-template<typename T>
+template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-T bpstd::any_cast(const any& operand)
+T bpstd::any_cast(const basic_any<Size,Align,Copyable>& operand)
 {
   using underlying_type = remove_cvref_t<T>;
 
@@ -894,37 +1441,37 @@ T bpstd::any_cast(const any& operand)
   return static_cast<T>(*p);
 }
 
-template<typename T>
+template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-T* bpstd::any_cast(any* operand)
+T* bpstd::any_cast(basic_any<Size,Align,Copyable>* operand)
   noexcept
 {
   if (!operand) {
     return nullptr;
   }
-  if (operand->type() != typeid(T)) {
+  if (!operand->template is_holding<T>()) {
     return nullptr;
   }
 
-  auto p = operand->m_storage_handler(any::operation::value,
+  auto p = operand->m_storage_handler(basic_any<Size,Align,Copyable>::operation::value,
                                       &operand->m_storage,
                                       nullptr);
   return const_cast<T*>(static_cast<const T*>(p));
 }
 
-template<typename T>
+template<typename T, std::size_t Size, std::size_t Align, bool Copyable>
 inline BPSTD_INLINE_VISIBILITY
-const T* bpstd::any_cast(const any* operand)
+const T* bpstd::any_cast(const basic_any<Size,Align,Copyable>* operand)
   noexcept
 {
   if (!operand) {
     return nullptr;
   }
-  if (operand->type() != typeid(T)) {
+  if (!operand->template is_holding<T>()) {
     return nullptr;
   }
 
-  auto* p = operand->m_storage_handler(any::operation::value,
+  auto* p = operand->m_storage_handler(basic_any<Size,Align,Copyable>::operation::value,
                                        &operand->m_storage,
                                        nullptr);
   return static_cast<const T*>(p);
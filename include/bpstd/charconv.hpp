@@ -0,0 +1,470 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file charconv.hpp
+///
+/// \brief This header provides definitions from the C++ header <charconv>
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_CHARCONV_HPP
+#define BPSTD_CHARCONV_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "detail/charconv_integer.hpp" // detail::parse_integer, etc
+#include "detail/charconv_float.hpp"   // detail::parse_float, etc
+
+#include "string_view.hpp" // string_view
+#include "span.hpp"        // span
+#include "type_traits.hpp" // enable_if_t, is_integral
+
+#include <system_error> // std::errc
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // enum class : chars_format
+  //============================================================================
+
+  /// \brief A bitmask of the formats that floating point values are converted
+  ///        to and from
+  enum class chars_format
+  {
+    scientific = 0x1,
+    fixed      = 0x2,
+    hex        = 0x4,
+    general    = fixed | scientific,
+  };
+
+  //============================================================================
+  // struct : from_chars_result
+  //============================================================================
+
+  /// \brief The result of a call to from_chars
+  struct from_chars_result
+  {
+    const char* ptr; ///< A pointer past the parsed characters
+    std::errc ec;    ///< The error, or a value-initialized std::errc
+  };
+
+  //============================================================================
+  // struct : to_chars_result
+  //============================================================================
+
+  /// \brief The result of a call to to_chars
+  struct to_chars_result
+  {
+    char* ptr;    ///< A pointer past the written characters
+    std::errc ec; ///< The error, or a value-initialized std::errc
+  };
+
+  namespace detail {
+
+    template <typename T>
+    using enable_if_charconv_integer_t = enable_if_t<
+      is_integral<T>::value && !is_same<remove_cv_t<T>, bool>::value,
+      int
+    >;
+
+    /// \brief Converts a chars_format into the style used for formatting
+    ///        and parsing
+    float_style to_float_style(chars_format fmt) noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // functions : from_chars
+  //============================================================================
+
+  /// \brief Parses an integer in \p base from the range [first, last)
+  ///
+  /// The characters are an optional '-' (for signed types only), followed
+  /// by digits; no whitespace, '+' or base prefix is accepted. This is not
+  /// affected by the current locale, and never allocates.
+  ///
+  /// On failure, \p value is unmodified and the result's \c ec is either
+  /// \c std::errc::invalid_argument if there were no digits, or
+  /// \c std::errc::result_out_of_range if the value does not fit in \p T.
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param value the value to parse into
+  /// \param base the base of the digits, between 2 and 36
+  /// \return a pointer past the parsed characters, and the error if any
+  template <typename T, detail::enable_if_charconv_integer_t<T> = 0>
+  from_chars_result from_chars(const char* first,
+                               const char* last,
+                               T& value,
+                               int base = 10) noexcept;
+
+  /// \brief Parses an integer in \p base from \p s
+  ///
+  /// \param s the characters to parse
+  /// \param value the value to parse into
+  /// \param base the base of the digits, between 2 and 36
+  /// \return a pointer past the parsed characters, and the error if any
+  template <typename T, detail::enable_if_charconv_integer_t<T> = 0>
+  from_chars_result from_chars(string_view s, T& value, int base = 10) noexcept;
+
+  /// \{
+  /// \brief Parses a floating point value in \p fmt from the range
+  ///        [first, last)
+  ///
+  /// The characters are an optional '-', followed by either 'inf',
+  /// 'infinity', 'nan' or 'nan(chars)' in any case, or a number:
+  ///
+  /// * general: digits with an optional fraction and optional exponent
+  /// * fixed: digits with an optional fraction
+  /// * scientific: digits with an optional fraction and a required exponent
+  /// * hex: hexadecimal digits with an optional fraction and optional 'p'
+  ///   exponent, without a '0x' prefix
+  ///
+  /// The result is correctly rounded. This is not affected by the current
+  /// locale, and never allocates.
+  ///
+  /// On failure, \p value is unmodified and the result's \c ec is either
+  /// \c std::errc::invalid_argument if there was no number, or
+  /// \c std::errc::result_out_of_range if the value overflows or
+  /// underflows to zero.
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param value the value to parse into
+  /// \param fmt the format to parse
+  /// \return a pointer past the parsed characters, and the error if any
+  from_chars_result from_chars(const char* first,
+                               const char* last,
+                               float& value,
+                               chars_format fmt = chars_format::general) noexcept;
+  from_chars_result from_chars(const char* first,
+                               const char* last,
+                               double& value,
+                               chars_format fmt = chars_format::general) noexcept;
+  /// \}
+
+  /// \{
+  /// \brief Parses a floating point value in \p fmt from \p s
+  ///
+  /// \param s the characters to parse
+  /// \param value the value to parse into
+  /// \param fmt the format to parse
+  /// \return a pointer past the parsed characters, and the error if any
+  from_chars_result from_chars(string_view s,
+                               float& value,
+                               chars_format fmt = chars_format::general) noexcept;
+  from_chars_result from_chars(string_view s,
+                               double& value,
+                               chars_format fmt = chars_format::general) noexcept;
+  /// \}
+
+  //============================================================================
+  // functions : to_chars
+  //============================================================================
+
+  /// \brief Formats the integer \p value in \p base into the range
+  ///        [first, last)
+  ///
+  /// Digits above 9 are written as lower-case letters, and negative values
+  /// are preceded by a '-'. Nothing is null-terminated.
+  ///
+  /// On failure, the result's \c ptr is \p last and its \c ec is
+  /// \c std::errc::value_too_large, and the contents of the range are
+  /// unspecified.
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param value the value to format
+  /// \param base the base of the digits, between 2 and 36
+  /// \return a pointer past the written characters, and the error if any
+  template <typename T, detail::enable_if_charconv_integer_t<T> = 0>
+  to_chars_result to_chars(char* first,
+                           char* last,
+                           T value,
+                           int base = 10) noexcept;
+
+  /// \brief Formats the integer \p value in \p base into \p buffer
+  ///
+  /// \param buffer the characters to write to
+  /// \param value the value to format
+  /// \param base the base of the digits, between 2 and 36
+  /// \return a pointer past the written characters, and the error if any
+  template <typename T, detail::enable_if_charconv_integer_t<T> = 0>
+  to_chars_result to_chars(span<char> buffer, T value, int base = 10) noexcept;
+
+  /// \{
+  /// \brief Formats \p value into the range [first, last), with the
+  ///        shortest digits that parse back to exactly \p value
+  ///
+  /// Fixed or scientific notation is used, whichever is shorter.
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param value the value to format
+  /// \return a pointer past the written characters, and the error if any
+  to_chars_result to_chars(char* first, char* last, float value) noexcept;
+  to_chars_result to_chars(char* first, char* last, double value) noexcept;
+  /// \}
+
+  /// \{
+  /// \brief Formats \p value in \p fmt into the range [first, last), with the
+  ///        shortest digits that parse back to exactly \p value
+  ///
+  /// The general format follows printf's '%g' with its default precision,
+  /// and the hex format writes the exact value without a '0x' prefix.
+  ///
+  /// \param first the start of the range
+  /// \param last the end of the range
+  /// \param value the value to format
+  /// \param fmt the format to write
+  /// \return a pointer past the written characters, and the error if any
+  to_chars_result to_chars(char* first,
+                           char* last,
+                           float value,
+                           chars_format fmt) noexcept;
+  to_chars_result to_chars(char* first,
+                           char* last,
+                           double value,
+                           chars_format fmt) noexcept;
+  /// \}
+
+  /// \{
+  /// \brief Formats \p value into \p buffer, with the shortest digits that
+  ///        parse back to exactly \p value
+  ///
+  /// \param buffer the characters to write to
+  /// \param value the value to format
+  /// \return a pointer past the written characters, and the error if any
+  to_chars_result to_chars(span<char> buffer, float value) noexcept;
+  to_chars_result to_chars(span<char> buffer, double value) noexcept;
+  to_chars_result to_chars(span<char> buffer, float value, chars_format fmt) noexcept;
+  to_chars_result to_chars(span<char> buffer, double value, chars_format fmt) noexcept;
+  /// \}
+
+} // namespace bpstd
+
+//==============================================================================
+// definitions : detail
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::float_style bpstd::detail::to_float_style(chars_format fmt)
+  noexcept
+{
+  switch (fmt) {
+    case chars_format::scientific: return float_style::scientific;
+    case chars_format::fixed:      return float_style::fixed;
+    case chars_format::hex:        return float_style::hex;
+    default:                       break;
+  }
+  return float_style::general;
+}
+
+//==============================================================================
+// functions : from_chars
+//==============================================================================
+
+template <typename T, bpstd::detail::enable_if_charconv_integer_t<T>>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::from_chars_result bpstd::from_chars(const char* first,
+                                           const char* last,
+                                           T& value,
+                                           int base)
+  noexcept
+{
+  auto ec = std::errc{};
+  const auto* const ptr = detail::parse_integer(first, last, base, value, ec);
+  return from_chars_result{ptr, ec};
+}
+
+template <typename T, bpstd::detail::enable_if_charconv_integer_t<T>>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::from_chars_result bpstd::from_chars(string_view s, T& value, int base)
+  noexcept
+{
+  return from_chars(s.data(), s.data() + s.size(), value, base);
+}
+
+inline
+bpstd::from_chars_result bpstd::from_chars(const char* first,
+                                           const char* last,
+                                           float& value,
+                                           chars_format fmt)
+  noexcept
+{
+  auto ec = std::errc{};
+  const auto style = detail::to_float_style(fmt);
+  const auto* const ptr = detail::parse_float(first, last, value, style, ec);
+  return from_chars_result{ptr, ec};
+}
+
+inline
+bpstd::from_chars_result bpstd::from_chars(const char* first,
+                                           const char* last,
+                                           double& value,
+                                           chars_format fmt)
+  noexcept
+{
+  auto ec = std::errc{};
+  const auto style = detail::to_float_style(fmt);
+  const auto* const ptr = detail::parse_float(first, last, value, style, ec);
+  return from_chars_result{ptr, ec};
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::from_chars_result bpstd::from_chars(string_view s,
+                                           float& value,
+                                           chars_format fmt)
+  noexcept
+{
+  return from_chars(s.data(), s.data() + s.size(), value, fmt);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::from_chars_result bpstd::from_chars(string_view s,
+                                           double& value,
+                                           chars_format fmt)
+  noexcept
+{
+  return from_chars(s.data(), s.data() + s.size(), value, fmt);
+}
+
+//==============================================================================
+// functions : to_chars
+//==============================================================================
+
+template <typename T, bpstd::detail::enable_if_charconv_integer_t<T>>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(char* first,
+                                       char* last,
+                                       T value,
+                                       int base)
+  noexcept
+{
+  auto* const ptr = detail::format_integer(first, last, value, base);
+  if (ptr == nullptr) {
+    return to_chars_result{last, std::errc::value_too_large};
+  }
+  return to_chars_result{ptr, std::errc{}};
+}
+
+template <typename T, bpstd::detail::enable_if_charconv_integer_t<T>>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer, T value, int base)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value, base);
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first, char* last, float value)
+  noexcept
+{
+  auto* const ptr = detail::format_float(first, last, value, detail::float_style::plain);
+  if (ptr == nullptr) {
+    return to_chars_result{last, std::errc::value_too_large};
+  }
+  return to_chars_result{ptr, std::errc{}};
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first, char* last, double value)
+  noexcept
+{
+  auto* const ptr = detail::format_float(first, last, value, detail::float_style::plain);
+  if (ptr == nullptr) {
+    return to_chars_result{last, std::errc::value_too_large};
+  }
+  return to_chars_result{ptr, std::errc{}};
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first,
+                                       char* last,
+                                       float value,
+                                       chars_format fmt)
+  noexcept
+{
+  const auto style = detail::to_float_style(fmt);
+  auto* const ptr = detail::format_float(first, last, value, style);
+  if (ptr == nullptr) {
+    return to_chars_result{last, std::errc::value_too_large};
+  }
+  return to_chars_result{ptr, std::errc{}};
+}
+
+inline
+bpstd::to_chars_result bpstd::to_chars(char* first,
+                                       char* last,
+                                       double value,
+                                       chars_format fmt)
+  noexcept
+{
+  const auto style = detail::to_float_style(fmt);
+  auto* const ptr = detail::format_float(first, last, value, style);
+  if (ptr == nullptr) {
+    return to_chars_result{last, std::errc::value_too_large};
+  }
+  return to_chars_result{ptr, std::errc{}};
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer, float value)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer, double value)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer,
+                                       float value,
+                                       chars_format fmt)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::to_chars_result bpstd::to_chars(span<char> buffer,
+                                       double value,
+                                       chars_format fmt)
+  noexcept
+{
+  return to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_CHARCONV_HPP */
@@ -0,0 +1,692 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file char_set_search.hpp
+///
+/// \brief This internal header provides the character-set search algorithms
+///        used by basic_string_view's find_first_of family of functions
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_CHAR_SET_SEARCH_HPP
+#define BPSTD_DETAIL_CHAR_SET_SEARCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"        // BPSTD_CPP14_CONSTEXPR, BPSTD_HAS_X86_SIMD_DISPATCH
+#include "string_search.hpp" // search_npos, is_value_comparing_traits, etc
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t, std::uint32_t, std::uintmax_t
+#include <type_traits> // std::make_unsigned
+
+#if BPSTD_HAS_X86_SIMD_DISPATCH
+# include <immintrin.h>
+#endif
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // class : byte_set
+    //==========================================================================
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// \brief A 256-bit membership table of byte values
+    ///
+    /// This turns the O(|set|) membership test of a character into a single
+    /// load and bit-test.
+    ////////////////////////////////////////////////////////////////////////////
+    class byte_set
+    {
+      //------------------------------------------------------------------------
+      // Constructors
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Constructs an empty byte_set
+      constexpr byte_set() noexcept;
+
+      //------------------------------------------------------------------------
+      // Modifiers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Adds the byte \p b to this set
+      ///
+      /// \param b the byte to add
+      BPSTD_CPP14_CONSTEXPR void insert(unsigned char b) noexcept;
+
+      //------------------------------------------------------------------------
+      // Observers
+      //------------------------------------------------------------------------
+    public:
+
+      /// \brief Checks whether the byte \p b is in this set
+      ///
+      /// \param b the byte to check
+      /// \return \c true if \p b is in this set
+      constexpr bool contains(unsigned char b) const noexcept;
+
+      /// \brief Gets the membership of the 16 bytes sharing the high-nibble
+      ///        \p high as a 16-bit mask indexed by the low-nibble
+      ///
+      /// \param high the high nibble, in the range [0, 16)
+      /// \return the membership mask
+      constexpr unsigned group(unsigned high) const noexcept;
+
+      //------------------------------------------------------------------------
+      // Private Members
+      //------------------------------------------------------------------------
+    private:
+
+      std::uint64_t m_bits[4];
+    };
+
+    //==========================================================================
+    // Character Set Utilities
+    //==========================================================================
+
+    /// \brief Checks whether \p c is representable as a byte value
+    ///
+    /// \param c the character to check
+    /// \return \c true if \p c is in the range [0, 256)
+    template <typename CharT>
+    constexpr bool is_byte_value(CharT c) noexcept;
+
+    /// \brief Builds a byte_set from the \p m characters in \p set
+    ///
+    /// \param set the characters to add
+    /// \param m the number of characters in \p set
+    /// \param out the byte_set to populate
+    /// \return \c true if every character in \p set is representable as a byte
+    template <typename CharT>
+    BPSTD_CPP14_CONSTEXPR bool make_byte_set(const CharT* set,
+                                             std::size_t m,
+                                             byte_set& out) noexcept;
+
+    /// \brief Checks whether \p c is one of the \p m characters in \p set
+    ///
+    /// \param c the character to check
+    /// \param set the characters to compare against
+    /// \param m the number of characters in \p set
+    /// \return \c true if \p c is in \p set
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR bool is_one_of(CharT c,
+                                         const CharT* set,
+                                         std::size_t m) noexcept;
+
+    //==========================================================================
+    // Character Set Search
+    //==========================================================================
+
+    /// \brief Finds the first character in \p s whose membership in \p set is
+    ///        \p matching
+    ///
+    /// Sets of byte-representable characters are tested through a byte_set.
+    /// At runtime, sufficiently long 'char' searches through sets with few
+    /// distinct high-nibbles (delimiters, whitespace, etc) are vectorized with
+    /// an SSSE3/AVX2 nibble-shuffle that is selected based on the CPU.
+    ///
+    /// \param s the characters to search
+    /// \param n the number of characters in \p s
+    /// \param set the set of characters to search for
+    /// \param m the number of characters in \p set
+    /// \param matching \c true to find a member of \p set, \c false to find a
+    ///                 non-member
+    /// \return the index of the first such character, or search_npos
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t set_search_forward(const CharT* s,
+                                                         std::size_t n,
+                                                         const CharT* set,
+                                                         std::size_t m,
+                                                         bool matching) noexcept;
+
+    /// \brief Finds the last character in \p s whose membership in \p set is
+    ///        \p matching
+    ///
+    /// \param s the characters to search
+    /// \param n the number of characters in \p s
+    /// \param set the set of characters to search for
+    /// \param m the number of characters in \p set
+    /// \param matching \c true to find a member of \p set, \c false to find a
+    ///                 non-member
+    /// \return the index of the last such character, or search_npos
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t set_search_reverse(const CharT* s,
+                                                         std::size_t n,
+                                                         const CharT* set,
+                                                         std::size_t m,
+                                                         bool matching) noexcept;
+
+#if BPSTD_HAS_X86_SIMD_DISPATCH
+
+    //==========================================================================
+    // Vectorized Character Set Search
+    //==========================================================================
+
+    /// \brief The smallest input that is searched with vector instructions
+    constexpr std::size_t simd_set_search_min_size = 16u;
+
+    /// \brief Lookup tables for a vectorized byte_set membership test
+    ///
+    /// Every high-nibble whose group of bytes is non-empty is assigned one of 8
+    /// bit classes. A byte \c b is a member if
+    /// <tt>(lo[b & 0xf] & hi[b >> 4]) != 0</tt>.
+    struct nibble_tables
+    {
+      unsigned char lo[16];
+      unsigned char hi[16];
+    };
+
+    /// \brief Builds the nibble_tables for \p set
+    ///
+    /// \param set the set of bytes
+    /// \param out the tables to populate
+    /// \return \c true if \p set has at most 8 distinct non-empty groups
+    bool make_nibble_tables(const byte_set& set, nibble_tables& out) noexcept;
+
+    bool cpu_supports_ssse3() noexcept;
+    bool cpu_supports_avx2() noexcept;
+
+    /// \{
+    /// \brief Searches \p s with a vectorized membership test
+    ///
+    /// \param s the bytes to search
+    /// \param n the number of bytes in \p s
+    /// \param set the set of bytes to search for
+    /// \param matching \c true to find a member of \p set, \c false to find a
+    ///                 non-member
+    /// \param out the result of the search, if one was performed
+    /// \return \c true if the search was vectorized
+    bool simd_set_search_forward(const unsigned char* s,
+                                 std::size_t n,
+                                 const byte_set& set,
+                                 bool matching,
+                                 std::size_t& out) noexcept;
+    bool simd_set_search_reverse(const unsigned char* s,
+                                 std::size_t n,
+                                 const byte_set& set,
+                                 bool matching,
+                                 std::size_t& out) noexcept;
+    /// \}
+
+    std::size_t ssse3_set_search_forward(const unsigned char* s,
+                                         std::size_t n,
+                                         const nibble_tables& tables,
+                                         bool matching) noexcept;
+    std::size_t ssse3_set_search_reverse(const unsigned char* s,
+                                         std::size_t n,
+                                         const nibble_tables& tables,
+                                         bool matching) noexcept;
+    std::size_t avx2_set_search_forward(const unsigned char* s,
+                                        std::size_t n,
+                                        const nibble_tables& tables,
+                                        bool matching) noexcept;
+    std::size_t avx2_set_search_reverse(const unsigned char* s,
+                                        std::size_t n,
+                                        const nibble_tables& tables,
+                                        bool matching) noexcept;
+
+#endif // BPSTD_HAS_X86_SIMD_DISPATCH
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// definition : class : byte_set
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::byte_set::byte_set()
+  noexcept
+  : m_bits{0u, 0u, 0u, 0u}
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+void bpstd::detail::byte_set::insert(unsigned char b)
+  noexcept
+{
+  m_bits[b / 64u] |= (std::uint64_t{1u} << (b % 64u));
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::byte_set::contains(unsigned char b)
+  const noexcept
+{
+  return ((m_bits[b / 64u] >> (b % 64u)) & 1u) != 0u;
+}
+
+inline BPSTD_INLINE_VISIBILITY constexpr
+unsigned bpstd::detail::byte_set::group(unsigned high)
+  const noexcept
+{
+  return static_cast<unsigned>((m_bits[high / 4u] >> ((high % 4u) * 16u)) & 0xffffu);
+}
+
+//==============================================================================
+// Character Set Utilities
+//==============================================================================
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::is_byte_value(CharT c)
+  noexcept
+{
+  return (static_cast<std::uintmax_t>(
+    static_cast<typename std::make_unsigned<CharT>::type>(c)
+  ) >> 8u) == 0u;
+}
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bool bpstd::detail::make_byte_set(const CharT* set,
+                                  std::size_t m,
+                                  byte_set& out)
+  noexcept
+{
+  for (auto i = std::size_t{0}; i < m; ++i) {
+    if (!is_byte_value(set[i])) {
+      return false;
+    }
+    out.insert(static_cast<unsigned char>(set[i]));
+  }
+  return true;
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bool bpstd::detail::is_one_of(CharT c,
+                              const CharT* set,
+                              std::size_t m)
+  noexcept
+{
+  if (!BPSTD_IS_CONSTANT_EVALUATED()) {
+    return Traits::find(set, m, c) != nullptr;
+  }
+  for (auto i = std::size_t{0}; i < m; ++i) {
+    if (Traits::eq(c, set[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+//==============================================================================
+// Character Set Search
+//==============================================================================
+
+template <typename Traits, typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::set_search_forward(const CharT* s,
+                                              std::size_t n,
+                                              const CharT* set,
+                                              std::size_t m,
+                                              bool matching)
+  noexcept
+{
+  if (matching && m == 1u) {
+    return search_forward<Traits>(s, n, set, m);
+  }
+
+  auto bytes = byte_set{};
+  if (is_value_comparing_traits<CharT,Traits>::value && make_byte_set(set, m, bytes)) {
+#if BPSTD_HAS_X86_SIMD_DISPATCH
+    if (sizeof(CharT) == 1u && !BPSTD_IS_CONSTANT_EVALUATED()) {
+      auto result = std::size_t{0};
+      if (simd_set_search_forward(reinterpret_cast<const unsigned char*>(s),
+                                  n, bytes, matching, result)) {
+        return result;
+      }
+    }
+#endif
+    for (auto i = std::size_t{0}; i < n; ++i) {
+      const auto c = s[i];
+      const auto found = is_byte_value(c) && bytes.contains(static_cast<unsigned char>(c));
+      if (found == matching) {
+        return i;
+      }
+    }
+    return search_npos;
+  }
+
+  for (auto i = std::size_t{0}; i < n; ++i) {
+    if (is_one_of<Traits>(s[i], set, m) == matching) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::set_search_reverse(const CharT* s,
+                                              std::size_t n,
+                                              const CharT* set,
+                                              std::size_t m,
+                                              bool matching)
+  noexcept
+{
+  auto bytes = byte_set{};
+  if (is_value_comparing_traits<CharT,Traits>::value && make_byte_set(set, m, bytes)) {
+#if BPSTD_HAS_X86_SIMD_DISPATCH
+    if (sizeof(CharT) == 1u && !BPSTD_IS_CONSTANT_EVALUATED()) {
+      auto result = std::size_t{0};
+      if (simd_set_search_reverse(reinterpret_cast<const unsigned char*>(s),
+                                  n, bytes, matching, result)) {
+        return result;
+      }
+    }
+#endif
+    auto i = n;
+    while (i != 0u) {
+      --i;
+      const auto c = s[i];
+      const auto found = is_byte_value(c) && bytes.contains(static_cast<unsigned char>(c));
+      if (found == matching) {
+        return i;
+      }
+    }
+    return search_npos;
+  }
+
+  auto i = n;
+  while (i != 0u) {
+    --i;
+    if (is_one_of<Traits>(s[i], set, m) == matching) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+#if BPSTD_HAS_X86_SIMD_DISPATCH
+
+//==============================================================================
+// Vectorized Character Set Search
+//==============================================================================
+
+inline
+bool bpstd::detail::make_nibble_tables(const byte_set& set, nibble_tables& out)
+  noexcept
+{
+  unsigned classes[8] = {};
+  auto count = 0u;
+
+  out = nibble_tables{};
+  for (auto high = 0u; high < 16u; ++high) {
+    const auto group = set.group(high);
+    if (group == 0u) {
+      continue;
+    }
+
+    // High-nibbles with identical groups can share a bit class
+    auto cls = 0u;
+    while (cls < count && classes[cls] != group) {
+      ++cls;
+    }
+    if (cls == count) {
+      if (count == 8u) {
+        return false;
+      }
+      classes[count++] = group;
+    }
+
+    const auto bit = static_cast<unsigned char>(1u << cls);
+    out.hi[high] = bit;
+    for (auto low = 0u; low < 16u; ++low) {
+      if (((group >> low) & 1u) != 0u) {
+        out.lo[low] = static_cast<unsigned char>(out.lo[low] | bit);
+      }
+    }
+  }
+  return true;
+}
+
+inline
+bool bpstd::detail::cpu_supports_ssse3()
+  noexcept
+{
+  static const bool result = (__builtin_cpu_init(),
+                              __builtin_cpu_supports("ssse3") != 0);
+  return result;
+}
+
+inline
+bool bpstd::detail::cpu_supports_avx2()
+  noexcept
+{
+  static const bool result = (__builtin_cpu_init(),
+                              __builtin_cpu_supports("avx2") != 0);
+  return result;
+}
+
+inline
+bool bpstd::detail::simd_set_search_forward(const unsigned char* s,
+                                            std::size_t n,
+                                            const byte_set& set,
+                                            bool matching,
+                                            std::size_t& out)
+  noexcept
+{
+  auto tables = nibble_tables{};
+  if (n < simd_set_search_min_size || !make_nibble_tables(set, tables)) {
+    return false;
+  }
+  if (n >= 32u && cpu_supports_avx2()) {
+    out = avx2_set_search_forward(s, n, tables, matching);
+    return true;
+  }
+  if (cpu_supports_ssse3()) {
+    out = ssse3_set_search_forward(s, n, tables, matching);
+    return true;
+  }
+  return false;
+}
+
+inline
+bool bpstd::detail::simd_set_search_reverse(const unsigned char* s,
+                                            std::size_t n,
+                                            const byte_set& set,
+                                            bool matching,
+                                            std::size_t& out)
+  noexcept
+{
+  auto tables = nibble_tables{};
+  if (n < simd_set_search_min_size || !make_nibble_tables(set, tables)) {
+    return false;
+  }
+  if (n >= 32u && cpu_supports_avx2()) {
+    out = avx2_set_search_reverse(s, n, tables, matching);
+    return true;
+  }
+  if (cpu_supports_ssse3()) {
+    out = ssse3_set_search_reverse(s, n, tables, matching);
+    return true;
+  }
+  return false;
+}
+
+//------------------------------------------------------------------------------
+
+// Each block computes a mask with one bit per byte that is set when the byte's
+// membership equals 'matching'. The final partial block is handled by
+// re-reading an overlapping full block, and discarding the bits of bytes that
+// were already scanned.
+
+#define BPSTD_SSSE3_SET_MASK(p) \
+  (static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8( \
+    _mm_and_si128( \
+      _mm_shuffle_epi8(lo, _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), nibble)), \
+      _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), 4), nibble)) \
+    ), \
+    zero \
+  ))) ^ invert)
+
+#define BPSTD_AVX2_SET_MASK(p) \
+  (static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8( \
+    _mm256_and_si256( \
+      _mm256_shuffle_epi8(lo, _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), nibble)), \
+      _mm256_shuffle_epi8(hi, _mm256_and_si256(_mm256_srli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), 4), nibble)) \
+    ), \
+    zero \
+  ))) ^ invert)
+
+__attribute__((target("ssse3")))
+inline
+std::size_t bpstd::detail::ssse3_set_search_forward(const unsigned char* s,
+                                                    std::size_t n,
+                                                    const nibble_tables& tables,
+                                                    bool matching)
+  noexcept
+{
+  const auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.lo));
+  const auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.hi));
+  const auto nibble = _mm_set1_epi8(0x0f);
+  const auto zero = _mm_setzero_si128();
+  const auto invert = matching ? std::uint32_t{0xffffu} : std::uint32_t{0u};
+
+  auto i = std::size_t{0};
+  for (; i + 16u <= n; i += 16u) {
+    const auto mask = BPSTD_SSSE3_SET_MASK(s + i);
+    if (mask != 0u) {
+      return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+  }
+  if (i != n) {
+    const auto start = n - 16u;
+    const auto mask = BPSTD_SSSE3_SET_MASK(s + start) >> (i - start);
+    if (mask != 0u) {
+      return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+  }
+  return search_npos;
+}
+
+__attribute__((target("ssse3")))
+inline
+std::size_t bpstd::detail::ssse3_set_search_reverse(const unsigned char* s,
+                                                    std::size_t n,
+                                                    const nibble_tables& tables,
+                                                    bool matching)
+  noexcept
+{
+  const auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.lo));
+  const auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.hi));
+  const auto nibble = _mm_set1_epi8(0x0f);
+  const auto zero = _mm_setzero_si128();
+  const auto invert = matching ? std::uint32_t{0xffffu} : std::uint32_t{0u};
+
+  auto end = n;
+  for (; end >= 16u; end -= 16u) {
+    const auto start = end - 16u;
+    const auto mask = BPSTD_SSSE3_SET_MASK(s + start);
+    if (mask != 0u) {
+      return start + 31u - static_cast<std::size_t>(__builtin_clz(mask));
+    }
+  }
+  if (end != 0u) {
+    const auto mask = BPSTD_SSSE3_SET_MASK(s) & ((std::uint32_t{1u} << end) - 1u);
+    if (mask != 0u) {
+      return 31u - static_cast<std::size_t>(__builtin_clz(mask));
+    }
+  }
+  return search_npos;
+}
+
+__attribute__((target("avx2")))
+inline
+std::size_t bpstd::detail::avx2_set_search_forward(const unsigned char* s,
+                                                   std::size_t n,
+                                                   const nibble_tables& tables,
+                                                   bool matching)
+  noexcept
+{
+  const auto lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.lo)));
+  const auto hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.hi)));
+  const auto nibble = _mm256_set1_epi8(0x0f);
+  const auto zero = _mm256_setzero_si256();
+  const auto invert = matching ? std::uint32_t{0xffffffffu} : std::uint32_t{0u};
+
+  auto i = std::size_t{0};
+  for (; i + 32u <= n; i += 32u) {
+    const auto mask = BPSTD_AVX2_SET_MASK(s + i);
+    if (mask != 0u) {
+      return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+  }
+  if (i != n) {
+    const auto start = n - 32u;
+    const auto mask = BPSTD_AVX2_SET_MASK(s + start) >> (i - start);
+    if (mask != 0u) {
+      return i + static_cast<std::size_t>(__builtin_ctz(mask));
+    }
+  }
+  return search_npos;
+}
+
+__attribute__((target("avx2")))
+inline
+std::size_t bpstd::detail::avx2_set_search_reverse(const unsigned char* s,
+                                                   std::size_t n,
+                                                   const nibble_tables& tables,
+                                                   bool matching)
+  noexcept
+{
+  const auto lo = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.lo)));
+  const auto hi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tables.hi)));
+  const auto nibble = _mm256_set1_epi8(0x0f);
+  const auto zero = _mm256_setzero_si256();
+  const auto invert = matching ? std::uint32_t{0xffffffffu} : std::uint32_t{0u};
+
+  auto end = n;
+  for (; end >= 32u; end -= 32u) {
+    const auto start = end - 32u;
+    const auto mask = BPSTD_AVX2_SET_MASK(s + start);
+    if (mask != 0u) {
+      return start + 31u - static_cast<std::size_t>(__builtin_clz(mask));
+    }
+  }
+  if (end != 0u) {
+    const auto mask = BPSTD_AVX2_SET_MASK(s) & ((std::uint32_t{1u} << end) - 1u);
+    if (mask != 0u) {
+      return 31u - static_cast<std::size_t>(__builtin_clz(mask));
+    }
+  }
+  return search_npos;
+}
+
+#undef BPSTD_SSSE3_SET_MASK
+#undef BPSTD_AVX2_SET_MASK
+
+#endif // BPSTD_HAS_X86_SIMD_DISPATCH
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_CHAR_SET_SEARCH_HPP */
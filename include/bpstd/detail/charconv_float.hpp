@@ -0,0 +1,1537 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file charconv_float.hpp
+///
+/// \brief This internal header provides the conversions between floating
+///        point values and characters
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_CHARCONV_FLOAT_HPP
+#define BPSTD_DETAIL_CHARCONV_FLOAT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp"
+#include "charconv_integer.hpp" // detail::write_decimal_digits, etc
+#include "charconv_tables.hpp"  // detail::charconv_tables
+
+#include <cfloat>       // FLT_EVAL_METHOD
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t, std::uint32_t
+#include <cstring>      // std::memcpy, std::memmove, std::memset
+#include <limits>       // std::numeric_limits
+#include <system_error> // std::errc
+
+#if defined(_MSC_VER) && defined(_M_X64)
+# include <intrin.h> // _umul128
+#endif
+
+// Small values are parsed exactly with a single floating point operation,
+// which is only correctly rounded if the operation is evaluated in the
+// precision of its type (and not, for example, on the x87 stack).
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+# define BPSTD_HAS_EXACT_FLOAT_EVAL 1
+#else
+# define BPSTD_HAS_EXACT_FLOAT_EVAL 0
+#endif
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // Floating Point Representation
+    //==========================================================================
+
+    /// \brief The layout of an IEEE-754 binary floating point type
+    template <typename T>
+    struct float_traits;
+
+    template <>
+    struct float_traits<double>
+    {
+      using bits_type = std::uint64_t;
+
+      enum : int {
+        mantissa_bits = 52,
+        exponent_bits = 11,
+        bias = 1023,
+
+        /// The largest power of ten that is exactly representable
+        max_exact_pow10 = 22,
+      };
+    };
+
+    template <>
+    struct float_traits<float>
+    {
+      using bits_type = std::uint32_t;
+
+      enum : int {
+        mantissa_bits = 23,
+        exponent_bits = 8,
+        bias = 127,
+
+        /// The largest power of ten that is exactly representable
+        max_exact_pow10 = 10,
+      };
+    };
+
+    /// \brief The style that a floating point value is formatted or parsed
+    ///        in
+    enum class float_style
+    {
+      plain,      ///< The shorter of fixed and scientific
+      fixed,      ///< Without an exponent
+      scientific, ///< With an exponent
+      general,    ///< Like printf's %g
+      hex,        ///< Hexadecimal digits, with a binary exponent
+    };
+
+    /// \brief A decimal value of \c digits * 10^exponent
+    struct decimal_float
+    {
+      std::uint64_t digits;
+      int exponent;
+    };
+
+    //==========================================================================
+    // Shortest Decimal
+    //==========================================================================
+
+    /// \brief Multiplies \p a and \p b
+    ///
+    /// \param a the first factor
+    /// \param b the second factor
+    /// \param high set to the high 64 bits of the product
+    /// \return the low 64 bits of the product
+    std::uint64_t umul128(std::uint64_t a,
+                          std::uint64_t b,
+                          std::uint64_t& high) noexcept;
+
+    /// \brief Computes (m * mul) >> j, where \p mul is a 128-bit value split
+    ///        into its low and high halves
+    ///
+    /// \pre 64 < j < 128
+    std::uint64_t mul_shift64(std::uint64_t m,
+                              const std::uint64_t* mul,
+                              int j) noexcept;
+
+    /// \brief Counts the leading zero bits of \p value
+    ///
+    /// \pre value != 0
+    int count_leading_zeros(std::uint64_t value) noexcept;
+
+    /// \brief Determines whether \p value is divisible by 5^p
+    bool is_multiple_of_pow5(std::uint64_t value, int p) noexcept;
+
+    /// \brief Determines whether \p value is divisible by 2^p
+    bool is_multiple_of_pow2(std::uint64_t value, int p) noexcept;
+
+    /// \brief Computes ceil(log2(5^e)), for 0 <= e <= 3528
+    int pow5_bits(int e) noexcept;
+
+    /// \brief Computes floor(log10(2^e)), for 0 <= e <= 1650
+    int log10_pow2(int e) noexcept;
+
+    /// \brief Computes floor(log10(5^e)), for 0 <= e <= 2620
+    int log10_pow5(int e) noexcept;
+
+    /// \brief Finds the shortest decimal that rounds back to the binary
+    ///        floating point value with the given fields
+    ///
+    /// This is the Ryu algorithm (Ulf Adams, "Ryu: Fast Float-to-String
+    /// Conversion", PLDI 2018), which is exact and only uses fixed-size
+    /// integer arithmetic. The same computation serves both \c float and
+    /// \c double, since the tables are wide enough for either.
+    ///
+    /// \pre the value is finite and non-zero
+    /// \param ieee_mantissa the stored mantissa bits
+    /// \param ieee_exponent the stored (biased) exponent bits
+    /// \param mantissa_bits the number of stored mantissa bits
+    /// \param bias the exponent bias
+    /// \return the shortest decimal, with no trailing zeros in its digits
+    decimal_float shortest_decimal(std::uint64_t ieee_mantissa,
+                                   std::uint32_t ieee_exponent,
+                                   int mantissa_bits,
+                                   int bias) noexcept;
+
+    //==========================================================================
+    // Formatting
+    //==========================================================================
+
+    /// \brief Writes the decimal digits of the integer m * 2^e2
+    ///
+    /// Large values are converted exactly through a fixed-size big integer.
+    ///
+    /// \pre m * 2^e2 is an integer below 2^1024
+    /// \param buffer a buffer of at least 310 characters
+    /// \param m the binary mantissa
+    /// \param e2 the binary exponent
+    /// \return the number of digits written
+    int write_exact_integer(char* buffer, std::uint64_t m, int e2) noexcept;
+
+    /// \brief Formats \p value in \p style into the range [first, last)
+    ///
+    /// Every style except hex writes the shortest digits that parse back to
+    /// exactly \p value.
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param value the value to format
+    /// \param style the style to format in
+    /// \return a pointer past the last character, or null if the range is
+    ///         too small
+    template <typename T>
+    char* format_float(char* first, char* last, T value, float_style style) noexcept;
+
+    //==========================================================================
+    // Parsing
+    //==========================================================================
+
+    /// \brief A decimal with a fixed number of digits, used to round parsed
+    ///        values that are not handled by any faster path
+    ///
+    /// The value is 0.d[0]d[1]...d[count - 1] * 10^point. Any digits past
+    /// the capacity only affect rounding, so are only remembered through
+    /// \c truncated; 800 digits is more than enough to decide the rounding
+    /// of any \c double.
+    ///
+    /// This is the multi-precision fallback used by Go's strconv package,
+    /// which shifts the decimal by powers of two until it lands in the range
+    /// of the mantissa.
+    struct decimal_number
+    {
+      enum : int { capacity = 800 };
+
+      int count;
+      int point;
+      bool truncated;
+      unsigned char digits[capacity];
+    };
+
+    /// \brief Appends the digit \p d to \p number
+    void decimal_push(decimal_number& number, unsigned d) noexcept;
+
+    /// \brief Removes trailing zero digits from \p number
+    void decimal_trim(decimal_number& number) noexcept;
+
+    /// \brief Multiplies \p number by 2^k
+    ///
+    /// \pre 0 < k <= 60
+    void decimal_left_shift(decimal_number& number, int k) noexcept;
+
+    /// \brief Divides \p number by 2^k
+    ///
+    /// \pre 0 < k <= 60
+    void decimal_right_shift(decimal_number& number, int k) noexcept;
+
+    /// \brief Multiplies \p number by 2^k, which may be negative
+    void decimal_shift(decimal_number& number, int k) noexcept;
+
+    /// \brief Rounds \p number to the nearest integer, ties to even
+    std::uint64_t decimal_rounded_integer(const decimal_number& number) noexcept;
+
+    /// \brief Rounds \p number to the nearest binary floating point value
+    ///
+    /// \param number the decimal to convert; this is modified
+    /// \param mantissa_bits the number of stored mantissa bits
+    /// \param exponent_bits the number of stored exponent bits
+    /// \param bias the exponent bias
+    /// \param overflow set to whether the value is too large
+    /// \return the bits of the value, without its sign
+    std::uint64_t decimal_to_bits(decimal_number& number,
+                                  int mantissa_bits,
+                                  int exponent_bits,
+                                  int bias,
+                                  bool& overflow) noexcept;
+
+    /// \brief Rounds m * 2^e2 to the nearest value of type \p T, ties to
+    ///        even
+    ///
+    /// \param m the binary mantissa, which is not zero
+    /// \param e2 the binary exponent
+    /// \param sticky whether any lower non-zero bits were dropped from \p m
+    /// \param value set to the rounded magnitude, if in range
+    /// \return \c false if the value overflows or underflows to zero
+    template <typename T>
+    bool compose_float(std::uint64_t m, long e2, bool sticky, T& value) noexcept;
+
+    /// \brief Rounds m10 * 10^e10 to the nearest value of type \p T, using
+    ///        the 125-bit powers of five from the Ryu tables
+    ///
+    /// The top 64 bits of the product are within one unit of the exact
+    /// value, which decides the rounding unless the bits below the mantissa
+    /// are too close to halfway. Those rare cases, and subnormal results,
+    /// are left to the exact fallback (this is the approach of Lemire,
+    /// "Number Parsing at a Gigabyte per Second", 2021).
+    ///
+    /// \param m10 the decimal mantissa, which is not zero
+    /// \param e10 the decimal exponent
+    /// \param value set to the rounded magnitude, on success
+    /// \return \c true if the value was rounded correctly
+    template <typename T>
+    bool approximate_decimal(std::uint64_t m10, long e10, T& value) noexcept;
+
+    /// \brief Parses a floating point value in \p style from the range
+    ///        [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param value the parsed value, only modified on success
+    /// \param style the style to parse
+    /// \param ec set to the error, if any
+    /// \return a pointer past the parsed characters
+    template <typename T>
+    const char* parse_float(const char* first,
+                            const char* last,
+                            T& value,
+                            float_style style,
+                            std::errc& ec) noexcept;
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// Shortest Decimal
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+std::uint64_t bpstd::detail::umul128(std::uint64_t a,
+                                     std::uint64_t b,
+                                     std::uint64_t& high)
+  noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+
+  const auto product = static_cast<uint128>(a) * b;
+  high = static_cast<std::uint64_t>(product >> 64u);
+  return static_cast<std::uint64_t>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return _umul128(a, b, &high);
+#else
+  const auto a_lo = a & 0xffffffffu;
+  const auto a_hi = a >> 32u;
+  const auto b_lo = b & 0xffffffffu;
+  const auto b_hi = b >> 32u;
+
+  const auto lo_lo = a_lo * b_lo;
+  const auto hi_lo = a_hi * b_lo;
+  const auto lo_hi = a_lo * b_hi;
+  const auto hi_hi = a_hi * b_hi;
+
+  const auto cross = (lo_lo >> 32u) + (hi_lo & 0xffffffffu) + lo_hi;
+  high = hi_hi + (hi_lo >> 32u) + (cross >> 32u);
+  return (cross << 32u) | (lo_lo & 0xffffffffu);
+#endif
+}
+
+inline BPSTD_INLINE_VISIBILITY
+std::uint64_t bpstd::detail::mul_shift64(std::uint64_t m,
+                                         const std::uint64_t* mul,
+                                         int j)
+  noexcept
+{
+  auto high1 = std::uint64_t{};
+  const auto low1 = umul128(m, mul[1], high1);
+  auto high0 = std::uint64_t{};
+  umul128(m, mul[0], high0);
+
+  const auto sum = high0 + low1;
+  if (sum < high0) {
+    ++high1;
+  }
+  const auto shift = static_cast<unsigned>(j - 64);
+  return (high1 << (64u - shift)) | (sum >> shift);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::is_multiple_of_pow5(std::uint64_t value, int p)
+  noexcept
+{
+  auto count = 0;
+  while (value % 5u == 0u) {
+    value /= 5u;
+    if (++count >= p) {
+      return true;
+    }
+  }
+  return count >= p;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::detail::count_leading_zeros(std::uint64_t value)
+  noexcept
+{
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_clzll(value);
+#else
+  auto count = 0;
+  for (; (value >> 63u) == 0u; value <<= 1u) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::is_multiple_of_pow2(std::uint64_t value, int p)
+  noexcept
+{
+  return (value & ((std::uint64_t{1u} << static_cast<unsigned>(p)) - 1u)) == 0u;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::detail::pow5_bits(int e)
+  noexcept
+{
+  return static_cast<int>((static_cast<std::uint32_t>(e) * 1217359u) >> 19u) + 1;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::detail::log10_pow2(int e)
+  noexcept
+{
+  return static_cast<int>((static_cast<std::uint32_t>(e) * 78913u) >> 18u);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::detail::log10_pow5(int e)
+  noexcept
+{
+  return static_cast<int>((static_cast<std::uint32_t>(e) * 732923u) >> 20u);
+}
+
+inline
+bpstd::detail::decimal_float
+  bpstd::detail::shortest_decimal(std::uint64_t ieee_mantissa,
+                                  std::uint32_t ieee_exponent,
+                                  int mantissa_bits,
+                                  int bias)
+  noexcept
+{
+  using tables = charconv_tables<>;
+
+  // The value is m2 * 2^e2. Both are offset by two extra bits so that the
+  // halfway points to the neighbouring values are integers as well
+  auto e2 = int{};
+  auto m2 = std::uint64_t{};
+  if (ieee_exponent == 0u) {
+    e2 = 1 - bias - mantissa_bits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = static_cast<int>(ieee_exponent) - bias - mantissa_bits - 2;
+    m2 = (std::uint64_t{1u} << static_cast<unsigned>(mantissa_bits)) | ieee_mantissa;
+  }
+  const auto accept_bounds = (m2 & 1u) == 0u;
+
+  // The lower halfway point is closer when the mantissa is at a power of two
+  const auto mv = 4u * m2;
+  const auto mm_shift = (ieee_mantissa != 0u || ieee_exponent <= 1u) ? 1u : 0u;
+
+  // Convert the value and its halfway points to decimal, as vr, vp and vm
+  auto vr = std::uint64_t{};
+  auto vp = std::uint64_t{};
+  auto vm = std::uint64_t{};
+  auto e10 = int{};
+  auto vm_is_trailing_zeros = false;
+  auto vr_is_trailing_zeros = false;
+
+  if (e2 >= 0) {
+    const auto q = log10_pow2(e2) - (e2 > 3 ? 1 : 0);
+    const auto k = tables::pow5_inv_bitcount + pow5_bits(q) - 1;
+    const auto i = -e2 + q + k;
+    const auto* const mul = tables::pow5_inv_split[q];
+
+    e10 = q;
+    vr = mul_shift64(mv, mul, i);
+    vp = mul_shift64(mv + 2u, mul, i);
+    vm = mul_shift64(mv - 1u - mm_shift, mul, i);
+
+    if (q <= 21) {
+      // At most one of mv, mp and mm can be a multiple of 5
+      if (mv % 5u == 0u) {
+        vr_is_trailing_zeros = is_multiple_of_pow5(mv, q);
+      } else if (accept_bounds) {
+        vm_is_trailing_zeros = is_multiple_of_pow5(mv - 1u - mm_shift, q);
+      } else if (is_multiple_of_pow5(mv + 2u, q)) {
+        --vp;
+      }
+    }
+  } else {
+    const auto q = log10_pow5(-e2) - (-e2 > 1 ? 1 : 0);
+    const auto i = -e2 - q;
+    const auto k = pow5_bits(i) - tables::pow5_bitcount;
+    const auto j = q - k;
+    const auto* const mul = tables::pow5_split[i];
+
+    e10 = q + e2;
+    vr = mul_shift64(mv, mul, j);
+    vp = mul_shift64(mv + 2u, mul, j);
+    vm = mul_shift64(mv - 1u - mm_shift, mul, j);
+
+    if (q <= 1) {
+      // mv has at least q trailing zero bits, so vr has q trailing zeros
+      vr_is_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_is_trailing_zeros = (mm_shift == 1u);
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_is_trailing_zeros = is_multiple_of_pow2(mv, q);
+    }
+  }
+
+  // Remove as many digits as possible while staying between the halfway
+  // points
+  auto removed = 0;
+  auto last_removed_digit = 0u;
+  auto output = std::uint64_t{};
+
+  if (vm_is_trailing_zeros || vr_is_trailing_zeros) {
+    // Rare: the exact value and its bounds must be tracked digit by digit
+    while (vp / 10u > vm / 10u) {
+      vm_is_trailing_zeros &= (vm % 10u == 0u);
+      vr_is_trailing_zeros &= (last_removed_digit == 0u);
+      last_removed_digit = static_cast<unsigned>(vr % 10u);
+      vr /= 10u;
+      vp /= 10u;
+      vm /= 10u;
+      ++removed;
+    }
+    if (vm_is_trailing_zeros) {
+      while (vm % 10u == 0u) {
+        vr_is_trailing_zeros &= (last_removed_digit == 0u);
+        last_removed_digit = static_cast<unsigned>(vr % 10u);
+        vr /= 10u;
+        vp /= 10u;
+        vm /= 10u;
+        ++removed;
+      }
+    }
+    if (vr_is_trailing_zeros && last_removed_digit == 5u && vr % 2u == 0u) {
+      // Exactly halfway between two outputs; round to even
+      last_removed_digit = 4u;
+    }
+    const auto round_up = (vr == vm && (!accept_bounds || !vm_is_trailing_zeros)) ||
+                          last_removed_digit >= 5u;
+    output = vr + (round_up ? 1u : 0u);
+  } else {
+    // Common: only the last removed digit matters for rounding
+    auto round_up = false;
+    if (vp / 100u > vm / 100u) {
+      round_up = (vr % 100u) >= 50u;
+      vr /= 100u;
+      vp /= 100u;
+      vm /= 100u;
+      removed += 2;
+    }
+    while (vp / 10u > vm / 10u) {
+      round_up = (vr % 10u) >= 5u;
+      vr /= 10u;
+      vp /= 10u;
+      vm /= 10u;
+      ++removed;
+    }
+    output = vr + ((vr == vm || round_up) ? 1u : 0u);
+  }
+
+  return decimal_float{output, e10 + removed};
+}
+
+//==============================================================================
+// Formatting
+//==============================================================================
+
+inline
+int bpstd::detail::write_exact_integer(char* buffer, std::uint64_t m, int e2)
+  noexcept
+{
+  if (e2 <= 0) {
+    const auto value = m >> static_cast<unsigned>(-e2);
+    const auto count = count_decimal_digits(value);
+    write_decimal_digits(buffer + count, value);
+    return count;
+  }
+
+  // The value is spread over 32-bit limbs, and converted nine digits at a
+  // time by repeated division
+  constexpr auto max_limbs = 34;
+  std::uint32_t limbs[max_limbs] = {};
+
+  const auto shift = static_cast<unsigned>(e2 % 32);
+  auto index = e2 / 32;
+  const auto shifted_lo = m << shift;
+  const auto shifted_hi = (shift == 0u) ? std::uint64_t{0u} : (m >> (64u - shift));
+  limbs[index] = static_cast<std::uint32_t>(shifted_lo);
+  limbs[index + 1] = static_cast<std::uint32_t>(shifted_lo >> 32u);
+  limbs[index + 2] = static_cast<std::uint32_t>(shifted_hi);
+  auto size = index + 3;
+  while (size > 0 && limbs[size - 1] == 0u) {
+    --size;
+  }
+
+  std::uint32_t chunks[36];
+  auto chunk_count = 0;
+  while (size > 0) {
+    auto remainder = std::uint64_t{0u};
+    for (index = size - 1; index >= 0; --index) {
+      const auto current = (remainder << 32u) | limbs[index];
+      limbs[index] = static_cast<std::uint32_t>(current / 1000000000u);
+      remainder = current % 1000000000u;
+    }
+    chunks[chunk_count++] = static_cast<std::uint32_t>(remainder);
+    while (size > 0 && limbs[size - 1] == 0u) {
+      --size;
+    }
+  }
+
+  // The most significant chunk is unpadded, and every other is nine digits
+  auto* it = buffer;
+  const auto leading = count_decimal_digits(chunks[chunk_count - 1]);
+  write_decimal_digits(it + leading, chunks[chunk_count - 1]);
+  it += leading;
+  for (auto i = chunk_count - 2; i >= 0; --i) {
+    std::memset(it, '0', 9u);
+    write_decimal_digits(it + 9, chunks[i]);
+    it += 9;
+  }
+  return static_cast<int>(it - buffer);
+}
+
+template <typename T>
+inline
+char* bpstd::detail::format_float(char* first, char* last, T value, float_style style)
+  noexcept
+{
+  using traits    = float_traits<T>;
+  using bits_type = typename traits::bits_type;
+
+  constexpr auto mantissa_mask = (bits_type{1u} << traits::mantissa_bits) - 1u;
+  constexpr auto exponent_mask = (1u << traits::exponent_bits) - 1u;
+
+  auto bits = bits_type{};
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const auto is_negative = (bits >> (traits::mantissa_bits + traits::exponent_bits)) != 0u;
+  const auto ieee_mantissa = static_cast<std::uint64_t>(bits & mantissa_mask);
+  const auto ieee_exponent = static_cast<std::uint32_t>(
+    (bits >> traits::mantissa_bits) & exponent_mask
+  );
+
+  // Writes a string that does not depend on the style
+  const auto write_literal = [&](const char* s, std::size_t n) -> char* {
+    const auto length = n + (is_negative ? 1u : 0u);
+    if (static_cast<std::size_t>(last - first) < length) {
+      return nullptr;
+    }
+    if (is_negative) {
+      *first++ = '-';
+    }
+    std::memcpy(first, s, n);
+    return first + n;
+  };
+
+  if (ieee_exponent == exponent_mask) {
+    return (ieee_mantissa == 0u) ? write_literal("inf", 3u) : write_literal("nan", 3u);
+  }
+
+  if (ieee_exponent == 0u && ieee_mantissa == 0u) {
+    switch (style) {
+      case float_style::scientific: return write_literal("0e+00", 5u);
+      case float_style::hex:        return write_literal("0p+0", 4u);
+      default:                      return write_literal("0", 1u);
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Hexadecimal
+  //----------------------------------------------------------------------------
+
+  if (style == float_style::hex) {
+    static constexpr char hex_digits[] = "0123456789abcdef";
+    constexpr auto nibbles = (traits::mantissa_bits + 3) / 4;
+
+    const auto leading = (ieee_exponent == 0u) ? '0' : '1';
+    const auto exponent = (ieee_exponent == 0u)
+      ? 1 - traits::bias
+      : static_cast<int>(ieee_exponent) - traits::bias;
+
+    // The mantissa is aligned to whole nibbles, without trailing zeros
+    auto mantissa = ieee_mantissa << (nibbles * 4 - traits::mantissa_bits);
+    auto count = nibbles;
+    while (count > 0 && (mantissa & 0xfu) == 0u) {
+      mantissa >>= 4u;
+      --count;
+    }
+
+    const auto abs_exponent = static_cast<std::uint64_t>(exponent < 0 ? -exponent : exponent);
+    const auto length = (is_negative ? 1 : 0) + 1 + (count > 0 ? count + 1 : 0) + 2 +
+                        count_decimal_digits(abs_exponent);
+    if ((last - first) < length) {
+      return nullptr;
+    }
+    if (is_negative) {
+      *first++ = '-';
+    }
+    *first++ = leading;
+    if (count > 0) {
+      *first++ = '.';
+      for (auto i = count - 1; i >= 0; --i) {
+        first[i] = hex_digits[mantissa & 0xfu];
+        mantissa >>= 4u;
+      }
+      first += count;
+    }
+    *first++ = 'p';
+    *first++ = (exponent < 0) ? '-' : '+';
+    return format_unsigned(first, last, abs_exponent, 10);
+  }
+
+  //----------------------------------------------------------------------------
+  // Decimal
+  //----------------------------------------------------------------------------
+
+  const auto decimal = shortest_decimal(ieee_mantissa,
+                                        ieee_exponent,
+                                        traits::mantissa_bits,
+                                        traits::bias);
+  const auto olength = count_decimal_digits(decimal.digits);
+  const auto sci_exponent = decimal.exponent + olength - 1;
+  const auto abs_sci_exponent = sci_exponent < 0 ? -sci_exponent : sci_exponent;
+  const auto sign_length = is_negative ? 1 : 0;
+
+  const auto sci_length = olength + (olength > 1 ? 1 : 0) + 2 +
+                          (abs_sci_exponent >= 100 ? 3 : 2);
+
+  // Integers are written with their exact digits in fixed notation, which
+  // may be one digit shorter than the shortest digits padded with zeros
+  // (for example 1e23 is exactly 99999999999999991611392)
+  char integer_digits[320];
+  auto integer_length = 0;
+  const auto format_integer_digits = [&]() {
+    const auto e2 = (ieee_exponent == 0u)
+      ? 1 - traits::bias - traits::mantissa_bits
+      : static_cast<int>(ieee_exponent) - traits::bias - traits::mantissa_bits;
+    const auto m2 = (ieee_exponent == 0u)
+      ? ieee_mantissa
+      : (ieee_mantissa | (std::uint64_t{1u} << traits::mantissa_bits));
+    integer_length = write_exact_integer(integer_digits, m2, e2);
+  };
+
+  auto use_fixed = false;
+  switch (style) {
+    case float_style::fixed: {
+      use_fixed = true;
+      break;
+    }
+    case float_style::scientific: {
+      use_fixed = false;
+      break;
+    }
+    case float_style::general: {
+      // As %g with the default precision of 6
+      use_fixed = (sci_exponent >= -4 && sci_exponent < 6);
+      break;
+    }
+    default: {
+      // The shorter of the two, preferring fixed on a tie
+      if (decimal.exponent >= 0) {
+        const auto padded_length = olength + decimal.exponent;
+        if (padded_length <= sci_length) {
+          use_fixed = true;
+        } else if (padded_length - 1 == sci_length) {
+          format_integer_digits();
+          use_fixed = (integer_length <= sci_length);
+        }
+      } else if (sci_exponent >= 0) {
+        use_fixed = (olength + 1) <= sci_length;
+      } else {
+        use_fixed = (olength + 1 - sci_exponent) <= sci_length;
+      }
+      break;
+    }
+  }
+
+  if (!use_fixed) {
+    if ((last - first) < sign_length + sci_length) {
+      return nullptr;
+    }
+    if (is_negative) {
+      *first++ = '-';
+    }
+    // The digits are written one place to the right, and the first digit is
+    // then moved in front of the decimal point
+    write_decimal_digits(first + olength + 1, decimal.digits);
+    first[0] = first[1];
+    if (olength > 1) {
+      first[1] = '.';
+      first += olength + 1;
+    } else {
+      first += 1;
+    }
+    *first++ = 'e';
+    *first++ = (sci_exponent < 0) ? '-' : '+';
+    // The exponent has at least two digits
+    const auto exponent_length = (abs_sci_exponent >= 100) ? 3 : 2;
+    first[0] = '0';
+    write_decimal_digits(first + exponent_length,
+                         static_cast<std::uint64_t>(abs_sci_exponent));
+    return first + exponent_length;
+  }
+
+  if (decimal.exponent >= 0) {
+    if (integer_length == 0) {
+      format_integer_digits();
+    }
+    if ((last - first) < sign_length + integer_length) {
+      return nullptr;
+    }
+    if (is_negative) {
+      *first++ = '-';
+    }
+    std::memcpy(first, integer_digits, static_cast<std::size_t>(integer_length));
+    return first + integer_length;
+  }
+
+  if (sci_exponent >= 0) {
+    // The decimal point falls between the digits
+    const auto integer_count = sci_exponent + 1;
+    if ((last - first) < sign_length + olength + 1) {
+      return nullptr;
+    }
+    if (is_negative) {
+      *first++ = '-';
+    }
+    write_decimal_digits(first + olength, decimal.digits);
+    std::memmove(first + integer_count + 1,
+                 first + integer_count,
+                 static_cast<std::size_t>(olength - integer_count));
+    first[integer_count] = '.';
+    return first + olength + 1;
+  }
+
+  // The value is below 1, and needs leading zeros after the decimal point
+  const auto zeros = -sci_exponent - 1;
+  if ((last - first) < sign_length + 2 + zeros + olength) {
+    return nullptr;
+  }
+  if (is_negative) {
+    *first++ = '-';
+  }
+  *first++ = '0';
+  *first++ = '.';
+  std::memset(first, '0', static_cast<std::size_t>(zeros));
+  first += zeros;
+  write_decimal_digits(first + olength, decimal.digits);
+  return first + olength;
+}
+
+//==============================================================================
+// Parsing
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::decimal_push(decimal_number& number, unsigned d)
+  noexcept
+{
+  if (number.count < decimal_number::capacity) {
+    number.digits[number.count++] = static_cast<unsigned char>(d);
+  } else if (d != 0u) {
+    number.truncated = true;
+  }
+}
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::decimal_trim(decimal_number& number)
+  noexcept
+{
+  while (number.count > 0 && number.digits[number.count - 1] == 0u) {
+    --number.count;
+  }
+  if (number.count == 0) {
+    number.point = 0;
+  }
+}
+
+inline
+void bpstd::detail::decimal_left_shift(decimal_number& number, int k)
+  noexcept
+{
+  using tables = charconv_tables<>;
+
+  // Shifting gains one digit fewer if the leading digits are below 5^k
+  const auto& entry = tables::left_shifts[k];
+  auto delta = entry.delta;
+  for (auto i = 0; entry.cutoff[i] != '\0'; ++i) {
+    if (i >= number.count) {
+      --delta;
+      break;
+    }
+    const auto digit = static_cast<char>('0' + number.digits[i]);
+    if (digit != entry.cutoff[i]) {
+      if (digit < entry.cutoff[i]) {
+        --delta;
+      }
+      break;
+    }
+  }
+
+  auto read = number.count;
+  auto write = number.count + delta;
+  auto n = std::uint64_t{0u};
+
+  const auto put = [&](std::uint64_t remainder) {
+    --write;
+    if (write < decimal_number::capacity) {
+      number.digits[write] = static_cast<unsigned char>(remainder);
+    } else if (remainder != 0u) {
+      number.truncated = true;
+    }
+  };
+
+  for (--read; read >= 0; --read) {
+    n += static_cast<std::uint64_t>(number.digits[read]) << static_cast<unsigned>(k);
+    const auto quotient = n / 10u;
+    put(n - (10u * quotient));
+    n = quotient;
+  }
+  while (n > 0u) {
+    const auto quotient = n / 10u;
+    put(n - (10u * quotient));
+    n = quotient;
+  }
+
+  number.count += delta;
+  if (number.count > decimal_number::capacity) {
+    number.count = decimal_number::capacity;
+  }
+  number.point += delta;
+  decimal_trim(number);
+}
+
+inline
+void bpstd::detail::decimal_right_shift(decimal_number& number, int k)
+  noexcept
+{
+  const auto shift = static_cast<unsigned>(k);
+  auto read = 0;
+  auto write = 0;
+  auto n = std::uint64_t{0u};
+
+  // Pick up enough leading digits to cover the first shift
+  for (; (n >> shift) == 0u; ++read) {
+    if (read >= number.count) {
+      if (n == 0u) {
+        number.count = 0;
+        return;
+      }
+      while ((n >> shift) == 0u) {
+        n *= 10u;
+        ++read;
+      }
+      break;
+    }
+    n = (n * 10u) + number.digits[read];
+  }
+  number.point -= read - 1;
+
+  const auto mask = (std::uint64_t{1u} << shift) - 1u;
+  for (; read < number.count; ++read) {
+    const auto digit = n >> shift;
+    n &= mask;
+    number.digits[write++] = static_cast<unsigned char>(digit);
+    n = (n * 10u) + number.digits[read];
+  }
+  while (n > 0u) {
+    const auto digit = n >> shift;
+    n &= mask;
+    if (write < decimal_number::capacity) {
+      number.digits[write++] = static_cast<unsigned char>(digit);
+    } else if (digit > 0u) {
+      number.truncated = true;
+    }
+    n *= 10u;
+  }
+  number.count = write;
+  decimal_trim(number);
+}
+
+inline
+void bpstd::detail::decimal_shift(decimal_number& number, int k)
+  noexcept
+{
+  // 60 bits, plus the 4 bits of the next digit, fit in the 64-bit
+  // accumulators of the shifts
+  constexpr auto max_shift = 60;
+
+  if (number.count == 0) {
+    return;
+  }
+  if (k > 0) {
+    for (; k > max_shift; k -= max_shift) {
+      decimal_left_shift(number, max_shift);
+    }
+    decimal_left_shift(number, k);
+  } else if (k < 0) {
+    for (; k < -max_shift; k += max_shift) {
+      decimal_right_shift(number, max_shift);
+    }
+    decimal_right_shift(number, -k);
+  }
+}
+
+inline
+std::uint64_t bpstd::detail::decimal_rounded_integer(const decimal_number& number)
+  noexcept
+{
+  if (number.point > 20) {
+    return std::numeric_limits<std::uint64_t>::max();
+  }
+
+  auto i = 0;
+  auto result = std::uint64_t{0u};
+  for (; i < number.point && i < number.count; ++i) {
+    result = (result * 10u) + number.digits[i];
+  }
+  for (; i < number.point; ++i) {
+    result *= 10u;
+  }
+
+  // Round up if the remaining digits are above half, or exactly half and
+  // the result is odd
+  const auto at = number.point;
+  if (at >= 0 && at < number.count) {
+    if (number.digits[at] == 5u && at + 1 == number.count) {
+      if (number.truncated || (at > 0 && (number.digits[at - 1] % 2u) == 1u)) {
+        ++result;
+      }
+    } else if (number.digits[at] >= 5u) {
+      ++result;
+    }
+  }
+  return result;
+}
+
+inline
+std::uint64_t bpstd::detail::decimal_to_bits(decimal_number& number,
+                                             int mantissa_bits,
+                                             int exponent_bits,
+                                             int bias,
+                                             bool& overflow)
+  noexcept
+{
+  // The number of bits to shift by to move the decimal point by N digits,
+  // without overshooting
+  static constexpr int powers[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+  constexpr auto power_count = static_cast<int>(sizeof(powers) / sizeof(powers[0]));
+
+  const auto max_biased = (1 << exponent_bits) - 1;
+  overflow = false;
+
+  if (number.count == 0 || number.point < -330) {
+    return 0u;
+  }
+  if (number.point > 310) {
+    overflow = true;
+    return static_cast<std::uint64_t>(max_biased) << mantissa_bits;
+  }
+
+  // Scale into [0.5, 1), tracking the power of two
+  auto exponent = 0;
+  while (number.point > 0) {
+    const auto n = (number.point >= power_count) ? 27 : powers[number.point];
+    decimal_shift(number, -n);
+    exponent += n;
+  }
+  while (number.point < 0 || (number.point == 0 && number.digits[0] < 5u)) {
+    const auto n = (-number.point >= power_count) ? 27 : powers[-number.point];
+    decimal_shift(number, n);
+    exponent -= n;
+  }
+
+  // The value is now in [1, 2) * 2^exponent
+  --exponent;
+
+  // Subnormal values have their mantissa shifted down to the minimum
+  // exponent
+  const auto min_exponent = 1 - bias;
+  if (exponent < min_exponent) {
+    const auto n = min_exponent - exponent;
+    decimal_shift(number, -n);
+    exponent += n;
+  }
+  if (exponent + bias >= max_biased) {
+    overflow = true;
+    return static_cast<std::uint64_t>(max_biased) << mantissa_bits;
+  }
+
+  decimal_shift(number, 1 + mantissa_bits);
+  auto mantissa = decimal_rounded_integer(number);
+
+  const auto implicit_bit = std::uint64_t{1u} << mantissa_bits;
+  if (mantissa == (implicit_bit << 1u)) {
+    // Rounding carried into a new bit
+    mantissa >>= 1u;
+    ++exponent;
+    if (exponent + bias >= max_biased) {
+      overflow = true;
+      return static_cast<std::uint64_t>(max_biased) << mantissa_bits;
+    }
+  }
+  const auto biased = ((mantissa & implicit_bit) == 0u) ? 0 : exponent + bias;
+
+  return (mantissa & (implicit_bit - 1u)) |
+         (static_cast<std::uint64_t>(biased) << mantissa_bits);
+}
+
+template <typename T>
+inline
+bool bpstd::detail::compose_float(std::uint64_t m, long e2, bool sticky, T& value)
+  noexcept
+{
+  using traits    = float_traits<T>;
+  using bits_type = typename traits::bits_type;
+
+  constexpr auto mantissa_bits = traits::mantissa_bits;
+  constexpr auto min_exponent = 1 - traits::bias;
+  constexpr auto max_exponent = traits::bias;
+
+  auto msb = 63;
+  while ((m >> msb) == 0u) {
+    --msb;
+  }
+  const auto top = msb + e2;
+  if (top > max_exponent) {
+    return false;
+  }
+
+  // The exponent of the lowest mantissa bit of the result
+  auto lsb = ((top < min_exponent) ? min_exponent : top) - mantissa_bits;
+  const auto shift = lsb - e2;
+
+  auto q = std::uint64_t{};
+  if (shift <= 0) {
+    q = m << static_cast<unsigned>(-shift);
+  } else if (shift < 64) {
+    const auto ushift = static_cast<unsigned>(shift);
+    const auto remainder = m & ((std::uint64_t{1u} << ushift) - 1u);
+    const auto half = std::uint64_t{1u} << (ushift - 1u);
+    q = m >> ushift;
+    if (remainder > half || (remainder == half && (sticky || (q & 1u) != 0u))) {
+      ++q;
+    }
+  } else if (shift == 64) {
+    const auto rest = (m << 1u) != 0u || sticky;
+    q = ((m >> 63u) != 0u && rest) ? 1u : 0u;
+  } else {
+    q = 0u;
+  }
+
+  if ((q >> (mantissa_bits + 1)) != 0u) {
+    q >>= 1u;
+    ++lsb;
+  }
+  if (q == 0u) {
+    return false;
+  }
+
+  auto bits = bits_type{};
+  if ((q >> mantissa_bits) != 0u) {
+    const auto biased = lsb + mantissa_bits + traits::bias;
+    if (biased >= (1 << traits::exponent_bits) - 1) {
+      return false;
+    }
+    bits = static_cast<bits_type>(
+      (q & ((std::uint64_t{1u} << mantissa_bits) - 1u)) |
+      (static_cast<std::uint64_t>(biased) << mantissa_bits)
+    );
+  } else {
+    bits = static_cast<bits_type>(q);
+  }
+  std::memcpy(&value, &bits, sizeof(value));
+  return true;
+}
+
+template <typename T>
+inline
+bool bpstd::detail::approximate_decimal(std::uint64_t m10, long e10, T& value)
+  noexcept
+{
+  using tables = charconv_tables<>;
+  using traits = float_traits<T>;
+
+  constexpr auto min_e10 = -341L;
+  constexpr auto max_e10 = 325L;
+
+  if (e10 < min_e10 || e10 > max_e10) {
+    return false;
+  }
+  const auto q = static_cast<int>(e10);
+  const auto lz = count_leading_zeros(m10);
+  const auto w = m10 << static_cast<unsigned>(lz);
+
+  // 5^q is approximated by mul * 2^scale, with mul a 125-bit integer
+  const std::uint64_t* mul = nullptr;
+  auto scale = 0;
+  if (q >= 0) {
+    mul = tables::pow5_split[q];
+    scale = pow5_bits(q) - tables::pow5_bitcount;
+  } else {
+    mul = tables::pow5_inv_split[-q];
+    scale = -(pow5_bits(-q) - 1 + tables::pow5_inv_bitcount);
+  }
+
+  // The product is 188 or 189 bits long; only its top 64 bits are kept
+  auto high = std::uint64_t{};
+  const auto middle_high = umul128(w, mul[1], high);
+  auto middle_low = std::uint64_t{};
+  umul128(w, mul[0], middle_low);
+  const auto middle = middle_high + middle_low;
+  if (middle < middle_high) {
+    ++high;
+  }
+  const auto shift = ((high >> 60u) != 0u) ? 125 : 124;
+  const auto m = (high << static_cast<unsigned>(128 - shift)) |
+                 (middle >> static_cast<unsigned>(shift - 64));
+  const auto e2 = static_cast<long>(shift + scale + q - lz);
+
+  // The exact value is within one unit of 'm', so the rounding is only known
+  // if the dropped bits are not near halfway
+  const auto top = 63 + e2;
+  if (top < 1 - traits::bias) {
+    return false;
+  }
+  constexpr auto dropped = 63 - traits::mantissa_bits;
+  constexpr auto half = std::uint64_t{1u} << (dropped - 1);
+  const auto remainder = m & ((half << 1u) - 1u);
+  if (remainder + 2u >= half && remainder <= half + 2u) {
+    return false;
+  }
+  return compose_float(m, e2, false, value);
+}
+
+template <typename T>
+inline
+const char* bpstd::detail::parse_float(const char* first,
+                                       const char* last,
+                                       T& value,
+                                       float_style style,
+                                       std::errc& ec)
+  noexcept
+{
+  using traits = float_traits<T>;
+
+  // Exponents are clamped well past any representable value, so that they
+  // can be accumulated without overflowing
+  constexpr auto max_exponent = 100000L;
+
+  const auto is_digit = [](char c) {
+    return static_cast<unsigned>(static_cast<unsigned char>(c) - '0') < 10u;
+  };
+  const auto is_hex_digit = [](char c) {
+    return digit_value(c) < 16u;
+  };
+  const auto matches = [&last](const char* it, const char* s) {
+    for (; *s != '\0'; ++it, ++s) {
+      if (it == last || static_cast<char>(*it | 0x20) != *s) {
+        return false;
+      }
+    }
+    return true;
+  };
+  const auto fail = [&](std::errc error) {
+    ec = error;
+    return first;
+  };
+
+  auto it = first;
+  auto is_negative = false;
+  if (it != last && *it == '-') {
+    is_negative = true;
+    ++it;
+  }
+
+  //----------------------------------------------------------------------------
+  // Infinity and NaN
+  //----------------------------------------------------------------------------
+
+  if (matches(it, "inf")) {
+    it += 3;
+    if (matches(it, "inity")) {
+      it += 5;
+    }
+    const auto infinity = std::numeric_limits<T>::infinity();
+    value = is_negative ? -infinity : infinity;
+    ec = std::errc{};
+    return it;
+  }
+  if (matches(it, "nan")) {
+    it += 3;
+    // An optional '(n-char-sequence)' is only consumed if it is closed
+    if (it != last && *it == '(') {
+      auto end = it + 1;
+      while (end != last && (digit_value(*end) < 36u || *end == '_')) {
+        ++end;
+      }
+      if (end != last && *end == ')') {
+        it = end + 1;
+      }
+    }
+    const auto nan = std::numeric_limits<T>::quiet_NaN();
+    value = is_negative ? -nan : nan;
+    ec = std::errc{};
+    return it;
+  }
+
+  //----------------------------------------------------------------------------
+  // Mantissa
+  //----------------------------------------------------------------------------
+
+  const auto is_hex = (style == float_style::hex);
+  const auto* const integer_first = it;
+  while (it != last && (is_hex ? is_hex_digit(*it) : is_digit(*it))) {
+    ++it;
+  }
+  const auto* const integer_last = it;
+  const auto* fraction_first = it;
+  const auto* fraction_last = it;
+  if (it != last && *it == '.') {
+    ++it;
+    fraction_first = it;
+    while (it != last && (is_hex ? is_hex_digit(*it) : is_digit(*it))) {
+      ++it;
+    }
+    fraction_last = it;
+  }
+  if (integer_first == integer_last && fraction_first == fraction_last) {
+    return fail(std::errc::invalid_argument);
+  }
+
+  //----------------------------------------------------------------------------
+  // Exponent
+  //----------------------------------------------------------------------------
+
+  auto exponent = 0L;
+  auto has_exponent = false;
+  const auto exponent_char = is_hex ? 'p' : 'e';
+  if (style != float_style::fixed && it != last && (*it | 0x20) == exponent_char) {
+    auto exponent_it = it + 1;
+    auto is_negative_exponent = false;
+    if (exponent_it != last && (*exponent_it == '+' || *exponent_it == '-')) {
+      is_negative_exponent = (*exponent_it == '-');
+      ++exponent_it;
+    }
+    if (exponent_it != last && is_digit(*exponent_it)) {
+      for (; exponent_it != last && is_digit(*exponent_it); ++exponent_it) {
+        if (exponent < max_exponent) {
+          exponent = (exponent * 10) + (*exponent_it - '0');
+        }
+      }
+      if (is_negative_exponent) {
+        exponent = -exponent;
+      }
+      has_exponent = true;
+      it = exponent_it;
+    }
+  }
+  if (style == float_style::scientific && !has_exponent) {
+    return fail(std::errc::invalid_argument);
+  }
+
+  const auto finish = [&](T magnitude) {
+    value = is_negative ? -magnitude : magnitude;
+    ec = std::errc{};
+    return it;
+  };
+  const auto out_of_range = [&]() {
+    ec = std::errc::result_out_of_range;
+    return it;
+  };
+
+  //----------------------------------------------------------------------------
+  // Hexadecimal
+  //----------------------------------------------------------------------------
+
+  if (is_hex) {
+    // The first 16 significant digits fill the mantissa, and the rest only
+    // matter for rounding
+    auto mantissa = std::uint64_t{0u};
+    auto count = 0;
+    auto e2 = exponent;
+    auto sticky = false;
+
+    for (auto p = integer_first; p != integer_last; ++p) {
+      const auto digit = digit_value(*p);
+      if (count == 0 && digit == 0u) {
+        continue;
+      }
+      if (count < 16) {
+        mantissa = (mantissa << 4u) | digit;
+        ++count;
+      } else {
+        e2 += 4;
+        sticky |= (digit != 0u);
+      }
+    }
+    for (auto p = fraction_first; p != fraction_last; ++p) {
+      const auto digit = digit_value(*p);
+      if (count == 0 && digit == 0u) {
+        e2 -= 4;
+        continue;
+      }
+      if (count < 16) {
+        mantissa = (mantissa << 4u) | digit;
+        ++count;
+        e2 -= 4;
+      } else {
+        sticky |= (digit != 0u);
+      }
+    }
+
+    if (mantissa == 0u) {
+      return finish(T{0});
+    }
+    auto magnitude = T{};
+    if (!compose_float(mantissa, e2, sticky, magnitude)) {
+      return out_of_range();
+    }
+    return finish(magnitude);
+  }
+
+  //----------------------------------------------------------------------------
+  // Decimal
+  //----------------------------------------------------------------------------
+
+  // Trailing zeros in the fraction do not change the value
+  while (fraction_last != fraction_first && fraction_last[-1] == '0') {
+    --fraction_last;
+  }
+
+  // Accumulate up to 19 significant digits, which always fit in 64 bits
+  auto mantissa = std::uint64_t{0u};
+  auto count = 0;
+  auto e10 = exponent;
+  for (auto p = integer_first; p != integer_last; ++p) {
+    const auto digit = static_cast<unsigned>(*p - '0');
+    if (count == 0 && digit == 0u) {
+      continue;
+    }
+    if (count < 19) {
+      mantissa = (mantissa * 10u) + digit;
+    } else {
+      ++e10;
+    }
+    ++count;
+  }
+  for (auto p = fraction_first; p != fraction_last; ++p) {
+    const auto digit = static_cast<unsigned>(*p - '0');
+    --e10;
+    if (count == 0 && digit == 0u) {
+      continue;
+    }
+    if (count < 19) {
+      mantissa = (mantissa * 10u) + digit;
+    }
+    ++count;
+  }
+
+  if (count == 0) {
+    return finish(T{0});
+  }
+
+#if BPSTD_HAS_EXACT_FLOAT_EVAL
+  // When the mantissa and the power of ten are both exact, a single
+  // correctly-rounded operation produces the correctly-rounded result
+  // (Clinger, "How to Read Floating Point Numbers Accurately", 1990)
+  constexpr auto max_exact_mantissa = std::uint64_t{1u} << (traits::mantissa_bits + 1);
+  if (count <= 19 &&
+      mantissa <= max_exact_mantissa &&
+      e10 >= -traits::max_exact_pow10 &&
+      e10 <= traits::max_exact_pow10) {
+    static constexpr double powers[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const auto power = static_cast<T>(powers[e10 < 0 ? -e10 : e10]);
+    const auto m = static_cast<T>(mantissa);
+    return finish(e10 < 0 ? m / power : m * power);
+  }
+#endif
+
+  if (count <= 19) {
+    auto magnitude = T{};
+    if (approximate_decimal(mantissa, e10, magnitude)) {
+      return finish(magnitude);
+    }
+  }
+
+  // Otherwise the digits are rounded exactly, in arbitrary precision
+  decimal_number number;
+  number.count = 0;
+  number.point = 0;
+  number.truncated = false;
+  for (auto p = integer_first; p != integer_last; ++p) {
+    const auto digit = static_cast<unsigned>(*p - '0');
+    if (number.count == 0 && digit == 0u) {
+      continue;
+    }
+    decimal_push(number, digit);
+    ++number.point;
+  }
+  for (auto p = fraction_first; p != fraction_last; ++p) {
+    const auto digit = static_cast<unsigned>(*p - '0');
+    if (number.count == 0 && digit == 0u) {
+      --number.point;
+      continue;
+    }
+    decimal_push(number, digit);
+  }
+  number.point += static_cast<int>(exponent);
+  decimal_trim(number);
+
+  auto overflow = false;
+  const auto bits = decimal_to_bits(number,
+                                    traits::mantissa_bits,
+                                    traits::exponent_bits,
+                                    traits::bias,
+                                    overflow);
+  if (overflow || bits == 0u) {
+    return out_of_range();
+  }
+  const auto narrow_bits = static_cast<typename traits::bits_type>(bits);
+  auto magnitude = T{};
+  std::memcpy(&magnitude, &narrow_bits, sizeof(magnitude));
+  return finish(magnitude);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_CHARCONV_FLOAT_HPP */
@@ -0,0 +1,426 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file charconv_integer.hpp
+///
+/// \brief This internal header provides the conversions between integers and
+///        characters
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_CHARCONV_INTEGER_HPP
+#define BPSTD_DETAIL_CHARCONV_INTEGER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp" // BPSTD_IS_LITTLE_ENDIAN
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t, std::uint32_t
+#include <cstring>      // std::memcpy
+#include <limits>       // std::numeric_limits
+#include <system_error> // std::errc
+#include <type_traits>  // std::make_unsigned
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // Parsing
+    //==========================================================================
+
+    /// \brief Gets the value of the digit \p c in any base up to 36
+    ///
+    /// \param c the character
+    /// \return the value of the digit, or a value of at least 36 if \p c is
+    ///         not a digit
+    unsigned digit_value(char c) noexcept;
+
+    /// \brief Determines whether the eight characters packed into \p chunk
+    ///        are all decimal digits
+    ///
+    /// \param chunk eight characters, the first in the lowest byte
+    /// \return \c true if every character is a digit
+    bool is_eight_digits(std::uint64_t chunk) noexcept;
+
+    /// \brief Converts eight decimal digits packed into \p chunk into their
+    ///        value, with a handful of multiplications
+    ///
+    /// \pre is_eight_digits(chunk)
+    /// \param chunk eight digits, the first in the lowest byte
+    /// \return the value of the digits
+    std::uint32_t parse_eight_digits(std::uint64_t chunk) noexcept;
+
+    /// \brief Parses the digits of an unsigned integer in \p base from the
+    ///        range [first, last)
+    ///
+    /// Every digit is consumed, even after the value has overflowed.
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param base the base of the digits, between 2 and 36
+    /// \param value the parsed value, if it did not overflow
+    /// \param overflow set to whether the value overflowed 64 bits
+    /// \return a pointer past the last digit
+    const char* parse_unsigned(const char* first,
+                               const char* last,
+                               int base,
+                               std::uint64_t& value,
+                               bool& overflow) noexcept;
+
+    /// \brief Parses an integer of type \p T from the range [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param base the base of the digits, between 2 and 36
+    /// \param value the parsed value, only modified on success
+    /// \param ec set to the error, if any
+    /// \return a pointer past the parsed characters
+    template <typename T>
+    const char* parse_integer(const char* first,
+                              const char* last,
+                              int base,
+                              T& value,
+                              std::errc& ec) noexcept;
+
+    //==========================================================================
+    // Formatting
+    //==========================================================================
+
+    /// \brief Counts the decimal digits in \p value
+    ///
+    /// \param value the value
+    /// \return the number of digits, which is at least 1
+    int count_decimal_digits(std::uint64_t value) noexcept;
+
+    /// \brief Writes the decimal digits of \p value so that they end at
+    ///        \p last, two at a time
+    ///
+    /// \pre there is room for count_decimal_digits(value) digits
+    /// \param last the end of the digits
+    /// \param value the value to write
+    void write_decimal_digits(char* last, std::uint64_t value) noexcept;
+
+    /// \brief Formats \p value in \p base into the range [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param value the value to format
+    /// \param base the base of the digits, between 2 and 36
+    /// \return a pointer past the last digit, or null if the range is too
+    ///         small
+    char* format_unsigned(char* first,
+                          char* last,
+                          std::uint64_t value,
+                          int base) noexcept;
+
+    /// \brief Formats the integer \p value in \p base into the range
+    ///        [first, last)
+    ///
+    /// \param first the start of the range
+    /// \param last the end of the range
+    /// \param value the value to format
+    /// \param base the base of the digits, between 2 and 36
+    /// \return a pointer past the last character, or null if the range is
+    ///         too small
+    template <typename T>
+    char* format_integer(char* first, char* last, T value, int base) noexcept;
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// Parsing
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+unsigned bpstd::detail::digit_value(char c)
+  noexcept
+{
+  const auto u = static_cast<unsigned char>(c);
+  if (u >= '0' && u <= '9') {
+    return static_cast<unsigned>(u - '0');
+  }
+  // Folding to lower-case maps both cases of a letter onto one range
+  const auto lower = static_cast<unsigned char>(u | 0x20u);
+  if (lower >= 'a' && lower <= 'z') {
+    return static_cast<unsigned>(lower - 'a') + 10u;
+  }
+  return 36u;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::detail::is_eight_digits(std::uint64_t chunk)
+  noexcept
+{
+  // A byte is a digit if its high nibble is 3, and adding 6 does not carry
+  // into the high nibble (which would make it one of ':' through '?')
+  return ((chunk & 0xf0f0f0f0f0f0f0f0u) |
+          (((chunk + 0x0606060606060606u) & 0xf0f0f0f0f0f0f0f0u) >> 4u)) ==
+         0x3333333333333333u;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+std::uint32_t bpstd::detail::parse_eight_digits(std::uint64_t chunk)
+  noexcept
+{
+  // Adjacent digits are combined into pairs, then the pairs into two
+  // four-digit halves, and finally the halves into the result
+  const auto mask = std::uint64_t{0x000000ff000000ffu};
+  const auto mul1 = std::uint64_t{100u + (1000000ull << 32u)};
+  const auto mul2 = std::uint64_t{1u + (10000ull << 32u)};
+
+  chunk -= 0x3030303030303030u;
+  chunk = (chunk * 10u) + (chunk >> 8u);
+  chunk = (((chunk & mask) * mul1) + (((chunk >> 16u) & mask) * mul2)) >> 32u;
+  return static_cast<std::uint32_t>(chunk);
+}
+
+inline
+const char* bpstd::detail::parse_unsigned(const char* first,
+                                          const char* last,
+                                          int base,
+                                          std::uint64_t& value,
+                                          bool& overflow)
+  noexcept
+{
+  constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+
+  auto result = std::uint64_t{0u};
+  auto it = first;
+  overflow = false;
+
+  if (base == 10) {
+    // Leading zeros never contribute to the value
+    while (it != last && *it == '0') {
+      ++it;
+    }
+    const auto* const significant = it;
+
+#if BPSTD_IS_LITTLE_ENDIAN
+    // Two chunks of eight digits can never overflow
+    for (auto i = 0; i < 2 && (last - it) >= 8; ++i) {
+      auto chunk = std::uint64_t{};
+      std::memcpy(&chunk, it, sizeof(chunk));
+      if (!is_eight_digits(chunk)) {
+        break;
+      }
+      result = (result * 100000000u) + parse_eight_digits(chunk);
+      it += 8;
+    }
+#endif
+
+    for (; it != last; ++it) {
+      const auto digit = static_cast<unsigned>(static_cast<unsigned char>(*it) - '0');
+      if (digit > 9u) {
+        break;
+      }
+      // Anything shorter than 20 digits fits in 64 bits
+      const auto count = it - significant;
+      if (count < 19) {
+        result = (result * 10u) + digit;
+      } else if (count == 19 && result <= (max - digit) / 10u) {
+        result = (result * 10u) + digit;
+      } else {
+        overflow = true;
+      }
+    }
+    value = result;
+    return it;
+  }
+
+  const auto ubase = static_cast<unsigned>(base);
+  for (; it != last; ++it) {
+    const auto digit = digit_value(*it);
+    if (digit >= ubase) {
+      break;
+    }
+    if (result > (max - digit) / ubase) {
+      overflow = true;
+    } else {
+      result = (result * ubase) + digit;
+    }
+  }
+  value = result;
+  return it;
+}
+
+template <typename T>
+inline
+const char* bpstd::detail::parse_integer(const char* first,
+                                         const char* last,
+                                         int base,
+                                         T& value,
+                                         std::errc& ec)
+  noexcept
+{
+  using unsigned_type = typename std::make_unsigned<T>::type;
+
+  auto it = first;
+  auto is_negative = false;
+  if (std::numeric_limits<T>::is_signed && it != last && *it == '-') {
+    is_negative = true;
+    ++it;
+  }
+
+  auto magnitude = std::uint64_t{};
+  auto overflow = false;
+  const auto* const end = parse_unsigned(it, last, base, magnitude, overflow);
+  if (end == it) {
+    ec = std::errc::invalid_argument;
+    return first;
+  }
+
+  // The most negative value has a magnitude one larger than the maximum
+  const auto limit = static_cast<std::uint64_t>(std::numeric_limits<T>::max()) +
+                     (is_negative ? 1u : 0u);
+  if (overflow || magnitude > limit) {
+    ec = std::errc::result_out_of_range;
+    return end;
+  }
+
+  const auto result = static_cast<unsigned_type>(magnitude);
+  value = static_cast<T>(is_negative ? static_cast<unsigned_type>(0u - result) : result);
+  ec = std::errc{};
+  return end;
+}
+
+//==============================================================================
+// Formatting
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::detail::count_decimal_digits(std::uint64_t value)
+  noexcept
+{
+  auto result = 1;
+  for (;;) {
+    if (value < 10u) { return result; }
+    if (value < 100u) { return result + 1; }
+    if (value < 1000u) { return result + 2; }
+    if (value < 10000u) { return result + 3; }
+    value /= 10000u;
+    result += 4;
+  }
+}
+
+inline
+void bpstd::detail::write_decimal_digits(char* last, std::uint64_t value)
+  noexcept
+{
+  static constexpr char pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+  while (value >= 100u) {
+    const auto pair = static_cast<std::size_t>(value % 100u) * 2u;
+    value /= 100u;
+    last -= 2;
+    last[0] = pairs[pair];
+    last[1] = pairs[pair + 1u];
+  }
+  if (value >= 10u) {
+    const auto pair = static_cast<std::size_t>(value) * 2u;
+    last -= 2;
+    last[0] = pairs[pair];
+    last[1] = pairs[pair + 1u];
+  } else {
+    *--last = static_cast<char>('0' + value);
+  }
+}
+
+inline
+char* bpstd::detail::format_unsigned(char* first,
+                                     char* last,
+                                     std::uint64_t value,
+                                     int base)
+  noexcept
+{
+  static constexpr char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+  if (base == 10) {
+    const auto count = count_decimal_digits(value);
+    if ((last - first) < count) {
+      return nullptr;
+    }
+    write_decimal_digits(first + count, value);
+    return first + count;
+  }
+
+  const auto ubase = static_cast<unsigned>(base);
+  auto count = 1;
+  for (auto v = value / ubase; v != 0u; v /= ubase) {
+    ++count;
+  }
+  if ((last - first) < count) {
+    return nullptr;
+  }
+
+  auto* const end = first + count;
+  auto* it = end;
+  if ((ubase & (ubase - 1u)) == 0u) {
+    // Powers of two are written with shifts rather than divisions
+    auto shift = 0u;
+    while ((1u << shift) != ubase) {
+      ++shift;
+    }
+    const auto mask = static_cast<std::uint64_t>(ubase - 1u);
+    do {
+      *--it = digits[value & mask];
+      value >>= shift;
+    } while (value != 0u);
+  } else {
+    do {
+      *--it = digits[value % ubase];
+      value /= ubase;
+    } while (value != 0u);
+  }
+  return end;
+}
+
+template <typename T>
+inline
+char* bpstd::detail::format_integer(char* first, char* last, T value, int base)
+  noexcept
+{
+  using unsigned_type = typename std::make_unsigned<T>::type;
+
+  auto magnitude = static_cast<unsigned_type>(value);
+  if (std::numeric_limits<T>::is_signed && value < T{0}) {
+    if (first == last) {
+      return nullptr;
+    }
+    *first++ = '-';
+    magnitude = static_cast<unsigned_type>(0u - magnitude);
+  }
+  return format_unsigned(first, last, static_cast<std::uint64_t>(magnitude), base);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_CHARCONV_INTEGER_HPP */
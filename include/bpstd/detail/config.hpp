@@ -63,6 +63,59 @@
 
 #define BPSTD_UNUSED(x) static_cast<void>(x)
 
+#if defined(__has_builtin)
+# define BPSTD_HAS_BUILTIN(x) __has_builtin(x)
+#else
+# define BPSTD_HAS_BUILTIN(x) 0
+#endif
+
+// BPSTD_IS_CONSTANT_EVALUATED() is used to select between a constexpr-friendly
+// implementation and a faster runtime one. If the compiler is unable to tell
+// the difference, this conservatively evaluates to 'true' whenever the
+// function may be 'constexpr'. Prior to C++14 none of the affected functions
+// are 'constexpr', so this is always 'false'.
+#if !defined(__cplusplus) || __cplusplus < 201402L
+# define BPSTD_IS_CONSTANT_EVALUATED() false
+#elif BPSTD_HAS_BUILTIN(__builtin_is_constant_evaluated) || \
+    (defined(_MSC_VER) && (_MSC_VER >= 1925))
+# define BPSTD_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+# define BPSTD_IS_CONSTANT_EVALUATED() true
+#endif
+
+// RTTI may be disabled with '-fno-rtti' or '/GR-', in which case 'typeid'
+// is unavailable for type-erased types
+#if defined(__cpp_rtti) || defined(__GXX_RTTI) || defined(_CPPRTTI)
+# define BPSTD_HAS_RTTI 1
+#else
+# define BPSTD_HAS_RTTI 0
+#endif
+
+// Vectorized code paths are compiled for specific instruction sets through
+// the 'target' attribute, and are selected at runtime based on the CPU.
+// Define BPSTD_DISABLE_SIMD to only use the portable implementations.
+#if !defined(BPSTD_DISABLE_SIMD) && \
+    (defined(__clang__) || defined(__GNUC__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+# define BPSTD_HAS_X86_SIMD_DISPATCH 1
+#else
+# define BPSTD_HAS_X86_SIMD_DISPATCH 0
+#endif
+
+// Some runtime paths load several bytes at once as a single integer, which
+// only agrees with the byte-by-byte implementation on little-endian machines
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+# if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#   define BPSTD_IS_LITTLE_ENDIAN 1
+# else
+#   define BPSTD_IS_LITTLE_ENDIAN 0
+# endif
+#elif defined(_MSC_VER)
+# define BPSTD_IS_LITTLE_ENDIAN 1
+#else
+# define BPSTD_IS_LITTLE_ENDIAN 0
+#endif
+
 // Use __may_alias__ attribute on gcc and clang
 #if defined(__clang__) || (defined(__GNUC__) && __GNUC__ > 5)
 # define BPSTD_MAY_ALIAS __attribute__((__may_alias__))
@@ -34,29 +34,81 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include "config.hpp"         // BPSTD_HAS_BUILTIN
+#include "../utility.hpp"     // index_sequence, make_index_sequence
+#include "../type_traits.hpp" // type_identity
+
 #include <cstddef> // std::size_t
 
+// '__type_pack_element' is a type-level builtin, so GCC only reports it
+// through '__has_builtin' from GCC 14 -- which is also when it was added
+#if BPSTD_HAS_BUILTIN(__type_pack_element)
+# define BPSTD_HAS_TYPE_PACK_ELEMENT 1
+#else
+# define BPSTD_HAS_TYPE_PACK_ELEMENT 0
+#endif
+
 namespace bpstd {
   namespace detail {
 
     /// \brief Gets the nth type from a variadic pack of arguments
     ///
+    /// This is a constant number of instantiations for each lookup. Without
+    /// the '__type_pack_element' builtin, the type is instead selected by
+    /// overload resolution against N ignored leading arguments, which only
+    /// costs the (shared) instantiation of make_index_sequence<N>.
+    ///
     /// \tparam N the argument to retrieve
     /// \tparam Args the arguments to extract from
     template <std::size_t N, typename...Args>
     struct nth_type;
 
-    template <std::size_t N, typename Arg0, typename...Args>
-    struct nth_type<N,Arg0,Args...> : nth_type<N-1,Args...>{};
+    template <std::size_t N, typename...Args>
+    using nth_type_t = typename nth_type<N,Args...>::type;
+
+    //==========================================================================
+    // definition : nth_type
+    //==========================================================================
+
+#if BPSTD_HAS_TYPE_PACK_ELEMENT
+
+    template <std::size_t N, typename...Args>
+    struct nth_type
+    {
+      static_assert(N < sizeof...(Args), "N index out of bounds");
+
+      using type = __type_pack_element<N,Args...>;
+    };
+
+#else
+
+    template <typename Seq>
+    struct nth_type_selector;
 
-    template <typename Arg0, typename...Args>
-    struct nth_type<0,Arg0,Args...>
+    template <std::size_t...Ignored>
+    struct nth_type_selector<index_sequence<Ignored...>>
     {
-      using type = Arg0;
+      // Each ignored index becomes a 'const volatile void*' parameter, so the
+      // Nth argument is the first one that is deduced. The remaining arguments
+      // are swallowed by the ellipsis.
+      template <typename T>
+      static T select(decltype(static_cast<const volatile void*>(
+                        static_cast<void>(Ignored), nullptr
+                      ))...,
+                      T*,
+                      ...);
     };
 
     template <std::size_t N, typename...Args>
-    using nth_type_t = typename nth_type<N,Args...>::type;
+    struct nth_type
+      : decltype(nth_type_selector<make_index_sequence<N>>::select(
+          static_cast<type_identity<Args>*>(nullptr)...
+        ))
+    {
+      static_assert(N < sizeof...(Args), "N index out of bounds");
+    };
+
+#endif
 
   } // namespace detail
 } // namespace bpstd
@@ -0,0 +1,286 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file string_hash.hpp
+///
+/// \brief This internal header provides the non-cryptographic hash function
+///        used to hash character sequences
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_STRING_HASH_HPP
+#define BPSTD_DETAIL_STRING_HASH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp" // BPSTD_CPP14_CONSTEXPR, BPSTD_IS_CONSTANT_EVALUATED,
+                      // BPSTD_IS_LITTLE_ENDIAN
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t, std::uint32_t
+#include <cstring>     // std::memcpy
+#include <type_traits> // std::make_unsigned
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // Hash Utilities
+    //==========================================================================
+
+    /// \{
+    /// \brief The secret constants used by the string hash
+    constexpr std::uint64_t string_hash_secret0 = 0x2d358dccaa6c78a5ull;
+    constexpr std::uint64_t string_hash_secret1 = 0x8bb84b93962eacc9ull;
+    constexpr std::uint64_t string_hash_secret2 = 0x4b33a62ed433d4a3ull;
+    constexpr std::uint64_t string_hash_secret3 = 0x4d5a2da51de1aa47ull;
+    /// \}
+
+    /// \brief Multiplies \p a and \p b as 128-bit integers, storing the low
+    ///        and high 64-bits back into \p a and \p b respectively
+    ///
+    /// \param a the first operand
+    /// \param b the second operand
+    BPSTD_CPP14_CONSTEXPR void hash_mum(std::uint64_t& a,
+                                        std::uint64_t& b) noexcept;
+
+    /// \brief Multiplies \p a and \p b as 128-bit integers, and folds the
+    ///        result back into 64-bits
+    ///
+    /// \param a the first operand
+    /// \param b the second operand
+    /// \return the folded product
+    BPSTD_CPP14_CONSTEXPR std::uint64_t hash_mix(std::uint64_t a,
+                                                 std::uint64_t b) noexcept;
+
+    /// \brief Reads the byte at \p offset in the object representation of the
+    ///        characters in \p s, assuming a little-endian representation
+    ///
+    /// \param s the characters to read
+    /// \param offset the byte offset to read
+    /// \return the byte
+    template <typename CharT>
+    constexpr std::uint64_t hash_read_byte(const CharT* s,
+                                           std::size_t offset) noexcept;
+
+    /// \{
+    /// \brief Reads 4 or 8 little-endian bytes at \p offset from the object
+    ///        representation of the characters in \p s
+    ///
+    /// \param s the characters to read
+    /// \param offset the byte offset to read
+    /// \return the bytes as an integer
+    template <typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::uint64_t hash_read4(const CharT* s,
+                                                   std::size_t offset) noexcept;
+    template <typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::uint64_t hash_read8(const CharT* s,
+                                                   std::size_t offset) noexcept;
+    /// \}
+
+    //==========================================================================
+    // Hash Functions
+    //==========================================================================
+
+    /// \brief Hashes the \p n characters in \p s
+    ///
+    /// This is derived from 'wyhash' (released into the public domain by
+    /// Wang Yi), and hashes the object representation of the characters 16 to
+    /// 48 bytes at a time.
+    ///
+    /// The result is the same during constant evaluation and at runtime,
+    /// and is independent of the platform on little-endian machines.
+    ///
+    /// \param s the characters to hash
+    /// \param n the number of characters in \p s
+    /// \param seed the seed for the hash
+    /// \return the 64-bit hash
+    template <typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::uint64_t hash_chars(const CharT* s,
+                                                   std::size_t n,
+                                                   std::uint64_t seed = 0u) noexcept;
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// Hash Utilities
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+void bpstd::detail::hash_mum(std::uint64_t& a, std::uint64_t& b)
+  noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 uint128;
+
+  const auto r = static_cast<uint128>(a) * b;
+  a = static_cast<std::uint64_t>(r);
+  b = static_cast<std::uint64_t>(r >> 64u);
+#else
+  const auto ha = a >> 32u;
+  const auto hb = b >> 32u;
+  const auto la = static_cast<std::uint32_t>(a);
+  const auto lb = static_cast<std::uint32_t>(b);
+
+  const auto rh = ha * hb;
+  const auto rm0 = ha * lb;
+  const auto rm1 = hb * la;
+  const auto rl = std::uint64_t{la} * lb;
+  const auto t = rl + (rm0 << 32u);
+  auto c = static_cast<std::uint64_t>(t < rl);
+  const auto lo = t + (rm1 << 32u);
+  c += static_cast<std::uint64_t>(lo < t);
+
+  a = lo;
+  b = rh + (rm0 >> 32u) + (rm1 >> 32u) + c;
+#endif
+}
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::uint64_t bpstd::detail::hash_mix(std::uint64_t a, std::uint64_t b)
+  noexcept
+{
+  hash_mum(a, b);
+  return a ^ b;
+}
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::uint64_t bpstd::detail::hash_read_byte(const CharT* s,
+                                            std::size_t offset)
+  noexcept
+{
+  return (static_cast<std::uint64_t>(
+    static_cast<typename std::make_unsigned<CharT>::type>(s[offset / sizeof(CharT)])
+  ) >> ((offset % sizeof(CharT)) * 8u)) & 0xffu;
+}
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::uint64_t bpstd::detail::hash_read4(const CharT* s,
+                                        std::size_t offset)
+  noexcept
+{
+#if BPSTD_IS_LITTLE_ENDIAN
+  if (!BPSTD_IS_CONSTANT_EVALUATED()) {
+    auto result = std::uint32_t{};
+    std::memcpy(&result, reinterpret_cast<const unsigned char*>(s) + offset, 4u);
+    return result;
+  }
+#endif
+  auto result = std::uint64_t{0u};
+  for (auto i = 0u; i < 4u; ++i) {
+    result |= hash_read_byte(s, offset + i) << (i * 8u);
+  }
+  return result;
+}
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::uint64_t bpstd::detail::hash_read8(const CharT* s,
+                                        std::size_t offset)
+  noexcept
+{
+#if BPSTD_IS_LITTLE_ENDIAN
+  if (!BPSTD_IS_CONSTANT_EVALUATED()) {
+    auto result = std::uint64_t{};
+    std::memcpy(&result, reinterpret_cast<const unsigned char*>(s) + offset, 8u);
+    return result;
+  }
+#endif
+  auto result = std::uint64_t{0u};
+  for (auto i = 0u; i < 8u; ++i) {
+    result |= hash_read_byte(s, offset + i) << (i * 8u);
+  }
+  return result;
+}
+
+//==============================================================================
+// Hash Functions
+//==============================================================================
+
+template <typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::uint64_t bpstd::detail::hash_chars(const CharT* s,
+                                        std::size_t n,
+                                        std::uint64_t seed)
+  noexcept
+{
+  const auto len = n * sizeof(CharT);
+  auto a = std::uint64_t{0u};
+  auto b = std::uint64_t{0u};
+
+  seed ^= hash_mix(seed ^ string_hash_secret0, string_hash_secret1);
+
+  if (len <= 16u) {
+    if (len >= 4u) {
+      const auto shift = (len >> 3u) << 2u;
+      a = (hash_read4(s, 0u) << 32u) | hash_read4(s, shift);
+      b = (hash_read4(s, len - 4u) << 32u) | hash_read4(s, len - 4u - shift);
+    } else if (len > 0u) {
+      a = (hash_read_byte(s, 0u) << 16u) |
+          (hash_read_byte(s, len >> 1u) << 8u) |
+          hash_read_byte(s, len - 1u);
+    }
+  } else {
+    auto offset = std::size_t{0u};
+    auto remaining = len;
+    if (remaining > 48u) {
+      auto see1 = seed;
+      auto see2 = seed;
+      do {
+        seed = hash_mix(hash_read8(s, offset) ^ string_hash_secret1,
+                        hash_read8(s, offset + 8u) ^ seed);
+        see1 = hash_mix(hash_read8(s, offset + 16u) ^ string_hash_secret2,
+                        hash_read8(s, offset + 24u) ^ see1);
+        see2 = hash_mix(hash_read8(s, offset + 32u) ^ string_hash_secret3,
+                        hash_read8(s, offset + 40u) ^ see2);
+        offset += 48u;
+        remaining -= 48u;
+      } while (remaining > 48u);
+      seed ^= see1 ^ see2;
+    }
+    while (remaining > 16u) {
+      seed = hash_mix(hash_read8(s, offset) ^ string_hash_secret1,
+                      hash_read8(s, offset + 8u) ^ seed);
+      offset += 16u;
+      remaining -= 16u;
+    }
+    a = hash_read8(s, offset + remaining - 16u);
+    b = hash_read8(s, offset + remaining - 8u);
+  }
+
+  a ^= string_hash_secret1;
+  b ^= seed;
+  hash_mum(a, b);
+  return hash_mix(a ^ string_hash_secret0 ^ len, b ^ string_hash_secret1);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_STRING_HASH_HPP */
@@ -0,0 +1,416 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file string_search.hpp
+///
+/// \brief This internal header provides the substring search algorithms used
+///        by basic_string_view
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_DETAIL_STRING_SEARCH_HPP
+#define BPSTD_DETAIL_STRING_SEARCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "config.hpp" // BPSTD_CPP14_CONSTEXPR, BPSTD_IS_CONSTANT_EVALUATED
+
+#include <cstddef>     // std::size_t
+#include <string>      // std::char_traits
+#include <type_traits> // std::true_type, std::false_type, std::make_unsigned
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // Search Utilities
+    //==========================================================================
+
+    /// \brief The sentinel value returned when a search does not match
+    constexpr std::size_t search_npos = static_cast<std::size_t>(-1);
+
+    /// \brief The number of buckets in a search skip-table
+    constexpr std::size_t search_table_size = 256u;
+
+    /// \brief The smallest needle that is searched with Horspool
+    ///
+    /// Smaller needles are dominated by the cost of building the skip table,
+    /// and are better served by skipping to the first character.
+    constexpr std::size_t horspool_min_needle_size = 4u;
+
+    /// \brief The smallest haystack that is searched with Horspool
+    constexpr std::size_t horspool_min_haystack_size = 256u;
+
+    /// \brief Determines whether \p Traits compares characters by value
+    ///
+    /// Only traits that compare by value may have their characters bucketed
+    /// into a skip-table; custom traits (such as case-insensitive traits)
+    /// always go through Traits::eq.
+    template <typename CharT, typename Traits>
+    struct is_value_comparing_traits : std::false_type{};
+
+    template <typename CharT>
+    struct is_value_comparing_traits<CharT,std::char_traits<CharT>>
+      : std::true_type{};
+
+    /// \brief Maps the character \p c to a bucket in a skip-table
+    ///
+    /// Wide characters share buckets by their low byte, which only ever makes
+    /// the computed skip more conservative.
+    ///
+    /// \param c the character to map
+    /// \return the bucket index
+    template <typename CharT>
+    constexpr std::size_t search_bucket(CharT c) noexcept;
+
+    /// \brief Compares \p count characters from \p lhs and \p rhs for equality
+    ///
+    /// \param lhs the first character sequence
+    /// \param rhs the second character sequence
+    /// \param count the number of characters to compare
+    /// \return \c true if the sequences are equal
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR bool search_equal(const CharT* lhs,
+                                            const CharT* rhs,
+                                            std::size_t count) noexcept;
+
+    //==========================================================================
+    // Forward Search
+    //==========================================================================
+
+    /// \brief Finds the first occurrence of \p needle in \p haystack
+    ///
+    /// At runtime, this skips between occurrences of the first needle
+    /// character with Traits::find (memchr for char). Large inputs whose first
+    /// needle character turns out to be common switch over to a
+    /// Boyer-Moore-Horspool search, which is sublinear on average.
+    ///
+    /// During constant evaluation only Traits::eq is used, so that this remains
+    /// usable in C++14 'constexpr' contexts.
+    ///
+    /// \param haystack the characters to search
+    /// \param n the number of characters in \p haystack
+    /// \param needle the characters to search for
+    /// \param m the number of characters in \p needle
+    /// \return the index of the first match, or search_npos
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t search_forward(const CharT* haystack,
+                                                     std::size_t n,
+                                                     const CharT* needle,
+                                                     std::size_t m) noexcept;
+
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t naive_search_forward(const CharT* haystack,
+                                                           std::size_t n,
+                                                           const CharT* needle,
+                                                           std::size_t m) noexcept;
+
+    template <typename Traits, typename CharT>
+    std::size_t first_char_search_forward(const CharT* haystack,
+                                          std::size_t n,
+                                          const CharT* needle,
+                                          std::size_t m) noexcept;
+
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t horspool_search_forward(const CharT* haystack,
+                                                              std::size_t n,
+                                                              const CharT* needle,
+                                                              std::size_t m) noexcept;
+
+    //==========================================================================
+    // Reverse Search
+    //==========================================================================
+
+    /// \brief Finds the last occurrence of \p needle in \p haystack
+    ///
+    /// This is the mirror of search_forward, with a reverse Horspool search for
+    /// large inputs.
+    ///
+    /// \param haystack the characters to search
+    /// \param n the number of characters in \p haystack
+    /// \param needle the characters to search for
+    /// \param m the number of characters in \p needle
+    /// \return the index of the last match, or search_npos
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t search_reverse(const CharT* haystack,
+                                                     std::size_t n,
+                                                     const CharT* needle,
+                                                     std::size_t m) noexcept;
+
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t naive_search_reverse(const CharT* haystack,
+                                                           std::size_t n,
+                                                           const CharT* needle,
+                                                           std::size_t m) noexcept;
+
+    template <typename Traits, typename CharT>
+    BPSTD_CPP14_CONSTEXPR std::size_t horspool_search_reverse(const CharT* haystack,
+                                                              std::size_t n,
+                                                              const CharT* needle,
+                                                              std::size_t m) noexcept;
+
+  } // namespace detail
+} // namespace bpstd
+
+//==============================================================================
+// Search Utilities
+//==============================================================================
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::size_t bpstd::detail::search_bucket(CharT c)
+  noexcept
+{
+  return static_cast<std::size_t>(
+    static_cast<typename std::make_unsigned<CharT>::type>(c)
+  ) % search_table_size;
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bool bpstd::detail::search_equal(const CharT* lhs,
+                                 const CharT* rhs,
+                                 std::size_t count)
+  noexcept
+{
+  if (!BPSTD_IS_CONSTANT_EVALUATED()) {
+    return Traits::compare(lhs, rhs, count) == 0;
+  }
+  for (auto i = std::size_t{0}; i < count; ++i) {
+    if (!Traits::eq(lhs[i], rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//==============================================================================
+// Forward Search
+//==============================================================================
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::search_forward(const CharT* haystack,
+                                          std::size_t n,
+                                          const CharT* needle,
+                                          std::size_t m)
+  noexcept
+{
+  if (m == 0u) {
+    return 0u;
+  }
+  if (m > n) {
+    return search_npos;
+  }
+  if (BPSTD_IS_CONSTANT_EVALUATED()) {
+    if (is_value_comparing_traits<CharT,Traits>::value &&
+        m >= horspool_min_needle_size &&
+        n >= horspool_min_haystack_size) {
+      return horspool_search_forward<Traits>(haystack, n, needle, m);
+    }
+    return naive_search_forward<Traits>(haystack, n, needle, m);
+  }
+  return first_char_search_forward<Traits>(haystack, n, needle, m);
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::naive_search_forward(const CharT* haystack,
+                                                std::size_t n,
+                                                const CharT* needle,
+                                                std::size_t m)
+  noexcept
+{
+  const auto last = n - m;
+  for (auto i = std::size_t{0}; i <= last; ++i) {
+    if (search_equal<Traits>(haystack + i, needle, m)) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+template <typename Traits, typename CharT>
+inline
+std::size_t bpstd::detail::first_char_search_forward(const CharT* haystack,
+                                                     std::size_t n,
+                                                     const CharT* needle,
+                                                     std::size_t m)
+  noexcept
+{
+  // Every candidate match must begin with needle[0], so Traits::find is used
+  // to skip directly to each candidate. For std::char_traits<char> this is
+  // memchr, which is vectorized by every major C library.
+  //
+  // This is the fastest strategy when the first character is rare. If it
+  // turns out to be common, the remainder of the haystack is handed over to
+  // the Horspool search instead, whose cost does not depend on it.
+  const bool can_switch = is_value_comparing_traits<CharT,Traits>::value &&
+                          m >= horspool_min_needle_size &&
+                          n >= horspool_min_haystack_size;
+  const auto* it = haystack;
+  const auto* const end = haystack + (n - m) + 1;
+  auto misses = std::size_t{0};
+
+  while (it != end) {
+    it = Traits::find(it, static_cast<std::size_t>(end - it), needle[0]);
+    if (it == nullptr) {
+      return search_npos;
+    }
+    if (Traits::compare(it + 1, needle + 1, m - 1) == 0) {
+      return static_cast<std::size_t>(it - haystack);
+    }
+    ++it;
+
+    const auto offset = static_cast<std::size_t>(it - haystack);
+    if (can_switch && it != end &&
+        ++misses > (offset / horspool_min_needle_size) + 16u) {
+      const auto result = horspool_search_forward<Traits>(it, n - offset, needle, m);
+      return (result == search_npos) ? search_npos : (result + offset);
+    }
+  }
+  return search_npos;
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::horspool_search_forward(const CharT* haystack,
+                                                   std::size_t n,
+                                                   const CharT* needle,
+                                                   std::size_t m)
+  noexcept
+{
+  // Each bucket holds the distance from the last occurrence of a character
+  // (excluding the final one) to the end of the needle. Colliding characters
+  // overwrite with smaller distances, so the shift is always safe.
+  std::size_t skip[search_table_size] = {};
+  for (auto& s : skip) {
+    s = m;
+  }
+  for (auto i = std::size_t{0}; i < m - 1; ++i) {
+    skip[search_bucket(needle[i])] = m - 1 - i;
+  }
+
+  if (n < m) {
+    return search_npos;
+  }
+
+  const auto tail = needle[m - 1];
+  const auto last = n - m;
+  auto i = std::size_t{0};
+  while (i <= last) {
+    const auto c = haystack[i + m - 1];
+    if (Traits::eq(c, tail) && search_equal<Traits>(haystack + i, needle, m - 1)) {
+      return i;
+    }
+    i += skip[search_bucket(c)];
+  }
+  return search_npos;
+}
+
+//==============================================================================
+// Reverse Search
+//==============================================================================
+
+template <typename Traits, typename CharT>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::search_reverse(const CharT* haystack,
+                                          std::size_t n,
+                                          const CharT* needle,
+                                          std::size_t m)
+  noexcept
+{
+  if (m == 0u) {
+    return n;
+  }
+  if (m > n) {
+    return search_npos;
+  }
+  if (is_value_comparing_traits<CharT,Traits>::value &&
+      m >= horspool_min_needle_size &&
+      n >= horspool_min_haystack_size) {
+    return horspool_search_reverse<Traits>(haystack, n, needle, m);
+  }
+  return naive_search_reverse<Traits>(haystack, n, needle, m);
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::naive_search_reverse(const CharT* haystack,
+                                                std::size_t n,
+                                                const CharT* needle,
+                                                std::size_t m)
+  noexcept
+{
+  auto i = n - m + 1;
+  while (i != 0u) {
+    --i;
+    if (Traits::eq(haystack[i], needle[0]) &&
+        search_equal<Traits>(haystack + i + 1, needle + 1, m - 1)) {
+      return i;
+    }
+  }
+  return search_npos;
+}
+
+template <typename Traits, typename CharT>
+inline BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::detail::horspool_search_reverse(const CharT* haystack,
+                                                   std::size_t n,
+                                                   const CharT* needle,
+                                                   std::size_t m)
+  noexcept
+{
+  // Mirror image of the forward table: each bucket holds the index of the
+  // first occurrence of a character (excluding the leading one).
+  std::size_t skip[search_table_size] = {};
+  for (auto& s : skip) {
+    s = m;
+  }
+  for (auto i = m - 1; i > 0u; --i) {
+    skip[search_bucket(needle[i])] = i;
+  }
+
+  const auto head = needle[0];
+  auto i = n - m;
+  while (true) {
+    const auto c = haystack[i];
+    if (Traits::eq(c, head) && search_equal<Traits>(haystack + i + 1, needle + 1, m - 1)) {
+      return i;
+    }
+    const auto shift = skip[search_bucket(c)];
+    if (shift > i) {
+      break;
+    }
+    i -= shift;
+  }
+  return search_npos;
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_DETAIL_STRING_SEARCH_HPP */
@@ -34,14 +34,34 @@
 #include "config.hpp"         // BPSTD_CPP14_CONSTEXPR
 #include "variant_union.hpp"  // detail::variant_union
 
-#include <cstddef> // std::size_t
-#include <utility> // std::forward
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint8_t, std::uint16_t, std::uint32_t
+#include <type_traits> // std::conditional
+#include <utility>     // std::forward
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
 namespace bpstd {
   namespace detail {
 
+    /// \brief A type-trait for the smallest unsigned type able to hold every
+    ///        index of a variant with \p N alternatives
+    ///
+    /// The largest value of the type is reserved as the sentinel for a
+    /// valueless_by_exception variant, so it is never a valid index.
+    template <std::size_t N>
+    struct variant_index
+      : std::conditional<(N < 0xffu), std::uint8_t,
+          typename std::conditional<(N < 0xffffu), std::uint16_t,
+            typename std::conditional<(N < 0xffffffffu), std::uint32_t,
+              std::size_t
+            >::type
+          >::type
+        >{};
+
+    template <std::size_t N>
+    using variant_index_t = typename variant_index<N>::type;
+
     //==========================================================================
     // class : variant_base
     //==========================================================================
@@ -74,8 +94,10 @@ namespace bpstd {
       //------------------------------------------------------------------------
     protected:
 
+      using index_type = variant_index_t<sizeof...(Types)>;
+
       variant_union<true,Types...> m_union;
-      std::size_t                  m_index;
+      index_type                   m_index;
 
       //---------------------------------------------------------------------
       // Protected Member Functions
@@ -106,8 +128,10 @@ namespace bpstd {
       //---------------------------------------------------------------------
     protected:
 
+      using index_type = variant_index_t<sizeof...(Types)>;
+
       variant_union<false,Types...> m_union;
-      std::size_t                   m_index;
+      index_type                    m_index;
 
       //---------------------------------------------------------------------
       // Protected Member Functions
@@ -146,7 +170,7 @@ template <typename...Types>
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::detail::variant_base<true,Types...>::variant_base()
   : m_union{},
-    m_index{static_cast<std::size_t>(-1)}
+    m_index{static_cast<index_type>(-1)}
 {
 
 }
@@ -170,7 +194,7 @@ template <typename...Types>
 inline BPSTD_INLINE_VISIBILITY
 void bpstd::detail::variant_base<true,Types...>::destroy_active_object()
 {
-  m_index = static_cast<std::size_t>(-1);
+  m_index = static_cast<index_type>(-1);
 }
 
 //==============================================================================
@@ -185,7 +209,7 @@ template <typename...Types>
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::detail::variant_base<false,Types...>::variant_base()
   : m_union{},
-    m_index{static_cast<std::size_t>(-1)}
+    m_index{static_cast<index_type>(-1)}
 {
 
 }
@@ -227,12 +251,12 @@ template <typename...Types>
 inline BPSTD_INLINE_VISIBILITY
 void bpstd::detail::variant_base<false,Types...>::destroy_active_object()
 {
-  if (m_index == static_cast<std::size_t>(-1)) {
+  if (m_index == static_cast<index_type>(-1)) {
     return;
   }
 
   visit_union(m_index, destroy_visitor{}, m_union);
-  m_index = static_cast<std::size_t>(-1);
+  m_index = static_cast<index_type>(-1);
 }
 
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
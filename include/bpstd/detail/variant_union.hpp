@@ -35,6 +35,7 @@
 #include "nth_type.hpp"       // detail::nth_type
 #include "move.hpp"           // forward
 #include "variant_traits.hpp"
+#include "../utility.hpp" // index_sequence
 
 #include <cstddef>     // std::size_t
 #include <type_traits> // std::decay
@@ -244,6 +245,28 @@ namespace bpstd {
     BPSTD_CPP14_CONSTEXPR bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion,UVariantUnion>
       visit_union(std::size_t n, Fn&& fn, VariantUnion&& v1, UVariantUnion&& v2);
 
+    /// \brief Visits the elements in each of the variant_unions \p vs, where
+    ///        \p n is the flattened index of their active members
+    ///
+    /// The flattened index is the row-major index into the cartesian product
+    /// of the alternatives, as computed by flatten_union_index.
+    ///
+    /// \param n the flattened index
+    /// \param fn the function to invoke on the underlying values
+    /// \param vs the variant_unions
+    template <typename Fn, typename...VariantUnions>
+    BPSTD_CPP14_CONSTEXPR bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnions...>
+      visit_union_product(std::size_t n, Fn&& fn, VariantUnions&&...vs);
+
+    /// \brief Computes the flattened index of the active members \p n0 and
+    ///        \p ns of unions of types \p VariantUnion and \p VariantUnions
+    ///
+    /// \param n0 the active index of the first union
+    /// \param ns the active indices of the remaining unions
+    /// \return the row-major index into the cartesian product
+    template <typename VariantUnion, typename...VariantUnions, typename...Indices>
+    constexpr std::size_t flatten_union_index(std::size_t n0, Indices...ns);
+
     /// \{
     /// \brief Gets the element at index \p N out of the variant_union
     ///
@@ -373,94 +396,145 @@ bpstd::detail::variant_union<B>::variant_union(variant_index_tag<0>)
 
 namespace bpstd { namespace detail {
 
-  // Single-case
+  // Unions with only a few alternatives are dispatched with a chain of
+  // branches, which the optimizer can turn into conditional moves or a
+  // switch. Larger unions dispatch through a table of function pointers
+  // indexed by the active alternative, so that visiting costs a single
+  // indirect call regardless of the number of alternatives.
+  constexpr std::size_t visit_union_branch_limit = 4u;
+
+  template <std::size_t N, typename Fn, typename...VariantUnions>
+  inline BPSTD_CPP14_CONSTEXPR
+  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnions...>
+    visit_union_at(Fn&& fn, VariantUnions&&...vs)
+  {
+    return bpstd::forward<Fn>(fn)(
+      union_get<N>(bpstd::forward<VariantUnions>(vs))...
+    );
+  }
+
+  //--------------------------------------------------------------------------
+  // Branch Dispatch
+  //--------------------------------------------------------------------------
 
-  template <typename Fn, typename VariantUnion>
+  template <std::size_t N, typename Fn, typename...VariantUnions>
   inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
-  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion>
-    do_visit_union(variant_index_tag<1>,
-                   std::size_t n,
-                   Fn&& fn,
-                   VariantUnion&& v)
+  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnions...>
+    visit_union_branch(variant_index_tag<N>,
+                       std::true_type, // is last
+                       std::size_t n,
+                       Fn&& fn,
+                       VariantUnions&&...vs)
   {
     BPSTD_UNUSED(n);
 
-    return bpstd::forward<Fn>(fn)(
-      union_get<0>(bpstd::forward<VariantUnion>(v))
+    return visit_union_at<N>(
+      bpstd::forward<Fn>(fn),
+      bpstd::forward<VariantUnions>(vs)...
     );
   }
 
-  template <std::size_t N, typename Fn, typename VariantUnion>
+  template <std::size_t N, typename Fn, typename VariantUnion, typename...VariantUnions>
   inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
-  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion>
-    do_visit_union(variant_index_tag<N>,
-                   std::size_t n,
-                   Fn&& fn,
-                   VariantUnion&& v)
+  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion,VariantUnions...>
+    visit_union_branch(variant_index_tag<N>,
+                       std::false_type, // is last
+                       std::size_t n,
+                       Fn&& fn,
+                       VariantUnion&& v,
+                       VariantUnions&&...vs)
   {
     using size_type = variant_union_size<VariantUnion>;
+    using is_last   = std::integral_constant<bool,(N + 2 == size_type::value)>;
 
-    if (n == 0) {
-      return bpstd::forward<Fn>(fn)(
-        union_get<0>(bpstd::forward<VariantUnion>(v))
+    if (n == N) {
+      return visit_union_at<N>(
+        bpstd::forward<Fn>(fn),
+        bpstd::forward<VariantUnion>(v),
+        bpstd::forward<VariantUnions>(vs)...
       );
     }
 
-    return do_visit_union(
-      variant_index_tag<(size_type::value - 1)>{},
-      n-1,
+    return visit_union_branch(
+      variant_index_tag<N + 1>{},
+      is_last{},
+      n,
       bpstd::forward<Fn>(fn),
-      static_cast<match_cvref_t<VariantUnion,decltype(v.next)>>(v.next)
+      bpstd::forward<VariantUnion>(v),
+      bpstd::forward<VariantUnions>(vs)...
     );
   }
 
-  // Double-case
+  //--------------------------------------------------------------------------
+  // Table Dispatch
+  //--------------------------------------------------------------------------
+
+  template <typename Fn, typename IndexSequence, typename...VariantUnions>
+  struct visit_union_table;
+
+  template <typename Fn, std::size_t...Idxs, typename...VariantUnions>
+  struct visit_union_table<Fn, index_sequence<Idxs...>, VariantUnions...>
+  {
+    using result_type   = variant_visitor_invoke_result_t<Fn,VariantUnions...>;
+    using function_type = result_type(*)(Fn&&, VariantUnions&&...);
+
+    static constexpr function_type table[sizeof...(Idxs)] = {
+      &visit_union_at<Idxs, Fn, VariantUnions...>...
+    };
+  };
+
+  template <typename Fn, std::size_t...Idxs, typename...VariantUnions>
+  constexpr typename visit_union_table<Fn, index_sequence<Idxs...>, VariantUnions...>::function_type
+    visit_union_table<Fn, index_sequence<Idxs...>, VariantUnions...>::table[sizeof...(Idxs)];
 
-  template <typename Fn, typename VariantUnion, typename UVariantUnion>
+  //--------------------------------------------------------------------------
+
+  template <typename Fn, typename VariantUnion, typename...VariantUnions>
   inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
-  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion,UVariantUnion>
-    do_visit_union(variant_index_tag<1>,
+  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion,VariantUnions...>
+    do_visit_union(std::true_type, // use branches
                    std::size_t n,
                    Fn&& fn,
-                   VariantUnion&& v0,
-                   UVariantUnion&& v1)
+                   VariantUnion&& v,
+                   VariantUnions&&...vs)
   {
-    BPSTD_UNUSED(n);
+    using size_type = variant_union_size<VariantUnion>;
+    using is_last   = std::integral_constant<bool,(size_type::value == 1u)>;
 
-    return bpstd::forward<Fn>(fn)(
-      union_get<0>(bpstd::forward<VariantUnion>(v0)),
-      union_get<0>(bpstd::forward<UVariantUnion>(v1))
+    return visit_union_branch(
+      variant_index_tag<0>{},
+      is_last{},
+      n,
+      bpstd::forward<Fn>(fn),
+      bpstd::forward<VariantUnion>(v),
+      bpstd::forward<VariantUnions>(vs)...
     );
   }
 
-  template <std::size_t N, typename Fn, typename VariantUnion, typename UVariantUnion>
+  template <typename Fn, typename VariantUnion, typename...VariantUnions>
   inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
-  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion,UVariantUnion>
-    do_visit_union(variant_index_tag<N>,
+  bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion,VariantUnions...>
+    do_visit_union(std::false_type, // use branches
                    std::size_t n,
                    Fn&& fn,
-                   VariantUnion&& v0,
-                   UVariantUnion&& v1)
+                   VariantUnion&& v,
+                   VariantUnions&&...vs)
   {
-    using size_type = variant_union_size<VariantUnion>;
-
-    if (n == 0) {
-      return bpstd::forward<Fn>(fn)(
-        union_get<0>(bpstd::forward<VariantUnion>(v0)),
-        union_get<0>(bpstd::forward<UVariantUnion>(v1))
-      );
-    }
+    using size_type  = variant_union_size<VariantUnion>;
+    using table_type = visit_union_table<
+      Fn,
+      make_index_sequence<size_type::value>,
+      VariantUnion,
+      VariantUnions...
+    >;
 
-    return do_visit_union(
-      variant_index_tag<(size_type::value - 1)>{},
-      n-1,
+    return table_type::table[n](
       bpstd::forward<Fn>(fn),
-      static_cast<match_cvref_t<VariantUnion,decltype(v0.next)>>(v0.next),
-      static_cast<match_cvref_t<UVariantUnion,decltype(v1.next)>>(v1.next)
+      bpstd::forward<VariantUnion>(v),
+      bpstd::forward<VariantUnions>(vs)...
     );
   }
 
-
 }} // namespace bpstd::detail
 
 template <typename Fn, typename VariantUnion>
@@ -468,10 +542,13 @@ inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
 bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnion>
   bpstd::detail::visit_union(std::size_t n, Fn&& fn, VariantUnion&& v)
 {
-  using size_type = variant_union_size<VariantUnion>;
+  using size_type    = variant_union_size<VariantUnion>;
+  using use_branches = std::integral_constant<bool,
+    (size_type::value <= visit_union_branch_limit)
+  >;
 
   return detail::do_visit_union(
-    variant_index_tag<size_type::value>{},
+    use_branches{},
     n,
     bpstd::forward<Fn>(fn),
     bpstd::forward<VariantUnion>(v)
@@ -486,10 +563,13 @@ bpstd::detail::variant_visitor_invoke_result_t<Fn, VariantUnion, UVariantUnion>
                              VariantUnion&& v1,
                              UVariantUnion&& v2)
 {
-  using size_type = variant_union_size<VariantUnion>;
+  using size_type    = variant_union_size<VariantUnion>;
+  using use_branches = std::integral_constant<bool,
+    (size_type::value <= visit_union_branch_limit)
+  >;
 
   return detail::do_visit_union(
-    variant_index_tag<size_type::value>{},
+    use_branches{},
     n,
     bpstd::forward<Fn>(fn),
     bpstd::forward<VariantUnion>(v1),
@@ -501,37 +581,193 @@ bpstd::detail::variant_visitor_invoke_result_t<Fn, VariantUnion, UVariantUnion>
 
 namespace bpstd { namespace detail {
 
-  // private implementation: recurse on index
+  // Visiting several unions at once dispatches through a single table over
+  // the cartesian product of their alternatives, so the cost of a visit does
+  // not depend on the number of unions being visited.
+
+  /// \brief A type-trait for the number of alternatives in the cartesian
+  ///        product of the variant unions
+  template <typename...VariantUnions>
+  struct variant_union_product_size
+    : std::integral_constant<std::size_t,1u>{};
+
+  template <typename VariantUnion, typename...VariantUnions>
+  struct variant_union_product_size<VariantUnion, VariantUnions...>
+    : std::integral_constant<std::size_t,
+        variant_union_size<VariantUnion>::value *
+        variant_union_product_size<VariantUnions...>::value
+      >{};
+
+  /// \brief A type-trait for converting the flattened index \p N back into
+  ///        an index_sequence of the active member of each union
+  template <std::size_t N, typename IndexSequence, typename...VariantUnions>
+  struct unflatten_union_index
+  {
+    using type = IndexSequence;
+  };
+
+  template <std::size_t N, std::size_t...Idxs, typename VariantUnion, typename...VariantUnions>
+  struct unflatten_union_index<N, index_sequence<Idxs...>, VariantUnion, VariantUnions...>
+    : unflatten_union_index<
+        (N % variant_union_product_size<VariantUnions...>::value),
+        index_sequence<Idxs..., (N / variant_union_product_size<VariantUnions...>::value)>,
+        VariantUnions...
+      >{};
+
+  template <typename IndexSequence, typename Fn, typename...VariantUnions>
+  struct visit_union_product_entry;
+
+  template <std::size_t...Idxs, typename Fn, typename...VariantUnions>
+  struct visit_union_product_entry<index_sequence<Idxs...>, Fn, VariantUnions...>
+  {
+    static inline BPSTD_CPP14_CONSTEXPR
+    variant_visitor_invoke_result_t<Fn,VariantUnions...>
+      visit(Fn&& fn, VariantUnions&&...vs)
+    {
+      return bpstd::forward<Fn>(fn)(
+        union_get<Idxs>(bpstd::forward<VariantUnions>(vs))...
+      );
+    }
+  };
 
-  template <std::size_t N, bool IsTrivial, typename...Types>
-  inline BPSTD_INLINE_VISIBILITY constexpr
-  nth_type_t<N,Types...>&
-    do_union_get(variant_index_tag<N>, variant_union<IsTrivial,Types...>& u)
+  template <typename Fn, typename IndexSequence, typename...VariantUnions>
+  struct visit_union_product_table;
+
+  template <typename Fn, std::size_t...Idxs, typename...VariantUnions>
+  struct visit_union_product_table<Fn, index_sequence<Idxs...>, VariantUnions...>
   {
-    return do_union_get(variant_index_tag<N-1>{}, u.next);
-  }
-  template <bool IsTrivial, typename...Types>
+    using result_type   = variant_visitor_invoke_result_t<Fn,VariantUnions...>;
+    using function_type = result_type(*)(Fn&&, VariantUnions&&...);
+
+    static constexpr function_type table[sizeof...(Idxs)] = {
+      &visit_union_product_entry<
+        typename unflatten_union_index<Idxs, index_sequence<>, VariantUnions...>::type,
+        Fn,
+        VariantUnions...
+      >::visit...
+    };
+  };
+
+  template <typename Fn, std::size_t...Idxs, typename...VariantUnions>
+  constexpr typename visit_union_product_table<Fn, index_sequence<Idxs...>, VariantUnions...>::function_type
+    visit_union_product_table<Fn, index_sequence<Idxs...>, VariantUnions...>::table[sizeof...(Idxs)];
+
+  template <typename VariantUnion>
   inline BPSTD_INLINE_VISIBILITY constexpr
-  nth_type_t<0,Types...>&
-    do_union_get(variant_index_tag<0>, variant_union<IsTrivial,Types...>& u)
+  std::size_t do_flatten_union_index(std::size_t n)
   {
-    return u.current;
+    return n;
   }
 
-  template <std::size_t N, bool IsTrivial, typename...Types>
+  template <typename VariantUnion, typename UVariantUnion, typename...VariantUnions, typename...Indices>
   inline BPSTD_INLINE_VISIBILITY constexpr
-  const nth_type_t<N,Types...>&
-    do_union_get(variant_index_tag<N>, const variant_union<IsTrivial,Types...>& u)
+  std::size_t do_flatten_union_index(std::size_t n, std::size_t n1, Indices...ns)
   {
-    return do_union_get(variant_index_tag<N-1>{}, u.next);
+    return do_flatten_union_index<UVariantUnion, VariantUnions...>(
+      (n * variant_union_size<UVariantUnion>::value) + n1,
+      ns...
+    );
   }
-  template <bool IsTrivial, typename...Types>
-  inline BPSTD_INLINE_VISIBILITY constexpr
-  const nth_type_t<0,Types...>&
-    do_union_get(variant_index_tag<0>, const variant_union<IsTrivial,Types...>& u)
+
+}} // namespace bpstd::detail
+
+template <typename Fn, typename...VariantUnions>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::detail::variant_visitor_invoke_result_t<Fn,VariantUnions...>
+  bpstd::detail::visit_union_product(std::size_t n, Fn&& fn, VariantUnions&&...vs)
+{
+  using size_type  = variant_union_product_size<VariantUnions...>;
+  using table_type = visit_union_product_table<
+    Fn,
+    make_index_sequence<size_type::value>,
+    VariantUnions...
+  >;
+
+  return table_type::table[n](
+    bpstd::forward<Fn>(fn),
+    bpstd::forward<VariantUnions>(vs)...
+  );
+}
+
+template <typename VariantUnion, typename...VariantUnions, typename...Indices>
+inline BPSTD_INLINE_VISIBILITY constexpr
+std::size_t bpstd::detail::flatten_union_index(std::size_t n0, Indices...ns)
+{
+  static_assert(
+    sizeof...(VariantUnions) == sizeof...(Indices),
+    "An index must be provided for each union"
+  );
+
+  return do_flatten_union_index<VariantUnion, VariantUnions...>(n0, ns...);
+}
+
+//------------------------------------------------------------------------------
+
+namespace bpstd { namespace detail {
+
+  // private implementation: recurse on index
+  //
+  // Each alternative is nested one 'next' deeper than the last, so reaching
+  // index N requires N member accesses. These are taken 8 at a time, which
+  // keeps the instantiation depth at N/8 + N%8 rather than N.
+
+  template <std::size_t N, bool Stride = (N >= 8u)>
+  struct union_getter
   {
-    return u.current;
-  }
+    template <bool IsTrivial, typename...Types>
+    static inline BPSTD_INLINE_VISIBILITY constexpr
+    nth_type_t<N,Types...>& get(variant_union<IsTrivial,Types...>& u)
+    {
+      return union_getter<N-1>::get(u.next);
+    }
+
+    template <bool IsTrivial, typename...Types>
+    static inline BPSTD_INLINE_VISIBILITY constexpr
+    const nth_type_t<N,Types...>& get(const variant_union<IsTrivial,Types...>& u)
+    {
+      return union_getter<N-1>::get(u.next);
+    }
+  };
+
+  template <std::size_t N>
+  struct union_getter<N,true>
+  {
+    template <bool IsTrivial, typename...Types>
+    static inline BPSTD_INLINE_VISIBILITY constexpr
+    nth_type_t<N,Types...>& get(variant_union<IsTrivial,Types...>& u)
+    {
+      return union_getter<N-8>::get(
+        u.next.next.next.next.next.next.next.next
+      );
+    }
+
+    template <bool IsTrivial, typename...Types>
+    static inline BPSTD_INLINE_VISIBILITY constexpr
+    const nth_type_t<N,Types...>& get(const variant_union<IsTrivial,Types...>& u)
+    {
+      return union_getter<N-8>::get(
+        u.next.next.next.next.next.next.next.next
+      );
+    }
+  };
+
+  template <>
+  struct union_getter<0,false>
+  {
+    template <bool IsTrivial, typename...Types>
+    static inline BPSTD_INLINE_VISIBILITY constexpr
+    nth_type_t<0,Types...>& get(variant_union<IsTrivial,Types...>& u)
+    {
+      return u.current;
+    }
+
+    template <bool IsTrivial, typename...Types>
+    static inline BPSTD_INLINE_VISIBILITY constexpr
+    const nth_type_t<0,Types...>& get(const variant_union<IsTrivial,Types...>& u)
+    {
+      return u.current;
+    }
+  };
 
 }} // namespace bpstd::detail
 
@@ -542,7 +778,7 @@ bpstd::detail::nth_type_t<N,Types...>&
 {
   static_assert(N < sizeof...(Types), "N index out of bounds");
 
-  return do_union_get(variant_index_tag<N>{}, u);
+  return union_getter<N>::get(u);
 }
 
 template <std::size_t N, bool IsTrivial, typename...Types>
@@ -552,7 +788,7 @@ const bpstd::detail::nth_type_t<N,Types...>&
 {
   static_assert(N < sizeof...(Types), "N index out of bounds");
 
-  return do_union_get(variant_index_tag<N>{}, u);
+  return union_getter<N>::get(u);
 }
 
 template <std::size_t N, bool IsTrivial, typename...Types>
@@ -562,7 +798,7 @@ bpstd::detail::nth_type_t<N,Types...>&&
 {
   static_assert(N < sizeof...(Types), "N index out of bounds");
 
-  return bpstd::move(do_union_get(variant_index_tag<N>{}, u));
+  return bpstd::move(union_getter<N>::get(u));
 }
 
 template <std::size_t N, bool IsTrivial, typename...Types>
@@ -572,7 +808,7 @@ const bpstd::detail::nth_type_t<N,Types...>&&
 {
   static_assert(N < sizeof...(Types), "N index out of bounds");
 
-  return bpstd::move(do_union_get(variant_index_tag<N>{}, u));
+  return bpstd::move(union_getter<N>::get(u));
 }
 
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
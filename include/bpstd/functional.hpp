@@ -40,6 +40,15 @@
 #include "detail/invoke.hpp"
 
 #include <functional> // to proxy API
+#include <memory>     // std::addressof
+#include <cstddef>    // std::size_t, std::nullptr_t
+#include <new>        // placement-new
+#include <cassert>    // assert
+#include <algorithm>  // std::search
+#include <iterator>   // std::iterator_traits, std::advance, std::distance
+#include <unordered_map> // std::unordered_map
+#include <utility>    // std::pair
+#include <vector>     // std::vector
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
@@ -108,6 +117,453 @@ namespace bpstd {
   template <typename Fn>
   constexpr detail::not_fn_t<decay_t<Fn>> not_fn(Fn&& fn);
 
+  namespace detail {
+
+    /// \brief Invokes \p fn with \p args, implicitly converting the result
+    ///        to \p R -- or discarding it if \p R is \c void
+    ///
+    /// \param fn the function to invoke
+    /// \param args the arguments to forward to the function
+    /// \return the result of the invocation
+    template <typename R, typename Fn, typename...Args>
+    constexpr enable_if_t<!is_void<R>::value,R>
+      invoke_r(Fn&& fn, Args&&...args);
+    template <typename R, typename Fn, typename...Args>
+    BPSTD_CPP14_CONSTEXPR enable_if_t<is_void<R>::value,R>
+      invoke_r(Fn&& fn, Args&&...args);
+
+  } // namespace detail
+
+  //============================================================================
+  // class : function_ref
+  //============================================================================
+
+  template <typename Signature>
+  class function_ref;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A non-owning reference to a callable object
+  ///
+  /// A function_ref is two pointers in size: one to the referenced callable,
+  /// and one to a function that invokes it. Calling through a function_ref
+  /// is a single indirect call, and it never allocates -- which makes it a
+  /// cheap replacement for \c std::function as a parameter type.
+  ///
+  /// Function pointers are stored by value, so a function_ref may safely
+  /// outlive the expression that names the function. All other callables,
+  /// including member pointers, are stored by address and must outlive the
+  /// function_ref.
+  ///
+  /// \tparam R the result type of the call
+  /// \tparam Args the argument types of the call
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename R, typename...Args>
+  class function_ref<R(Args...)>
+  {
+    // trait to determine if a callable may be referenced by this function_ref
+    template <typename Fn>
+    using is_referenceable = bool_constant<
+      !is_same<remove_cvref_t<Fn>,function_ref>::value &&
+      is_invocable_r<R,Fn&,Args...>::value
+    >;
+
+    // trait to determine if a callable is a function pointer, or a reference
+    // to a function, which are stored by value
+    template <typename Fn>
+    using is_function_pointer = bool_constant<
+      is_pointer<decay_t<Fn>>::value &&
+      is_function<remove_pointer_t<decay_t<Fn>>>::value
+    >;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs this function_ref as a reference to \p fn
+    ///
+    /// \param fn the callable to reference
+    template <typename Fn,
+              typename=enable_if_t<is_referenceable<Fn>::value>>
+    // cppcheck-suppress noExplicitConstructor
+    function_ref(Fn&& fn) noexcept;
+
+    /// \brief Copies the reference from \p other
+    ///
+    /// \param other the other function_ref to copy
+    function_ref(const function_ref& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Copies the reference from \p other
+    ///
+    /// \param other the other function_ref to copy
+    /// \return reference to \c (*this)
+    function_ref& operator=(const function_ref& other) noexcept = default;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Invokes the referenced callable with \p args
+    ///
+    /// \param args the arguments to forward to the callable
+    /// \return the result of the invocation
+    R operator()(Args...args) const;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    // Function pointers may not portably round-trip through 'void*', so they
+    // are stored as a distinct member
+    union storage
+    {
+      void* object;
+      void(*function)();
+    };
+
+    using invoker_type = R(*)(storage, Args&&...);
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \{
+    /// \brief Creates the storage for the callable \p fn
+    ///
+    /// \param fn the callable
+    /// \return the storage
+    template <typename Fn>
+    static storage make_storage(true_type is_function_pointer, Fn&& fn) noexcept;
+    template <typename Fn>
+    static storage make_storage(false_type is_function_pointer, Fn&& fn) noexcept;
+    /// \}
+
+    /// \{
+    /// \brief Creates the invoker for the callable type \p Fn
+    ///
+    /// \return the invoker
+    template <typename Fn>
+    static invoker_type make_invoker(true_type is_function_pointer) noexcept;
+    template <typename Fn>
+    static invoker_type make_invoker(false_type is_function_pointer) noexcept;
+    /// \}
+
+    /// \{
+    /// \brief Invokes the callable in \p s with \p args
+    ///
+    /// \param s the storage for the callable
+    /// \param args the arguments to forward to the callable
+    /// \return the result of the invocation
+    template <typename Fn>
+    static R invoke_function(storage s, Args&&...args);
+    template <typename Fn>
+    static R invoke_object(storage s, Args&&...args);
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    storage m_storage;
+    invoker_type m_invoker;
+  };
+
+  //============================================================================
+  // class : basic_unique_function
+  //============================================================================
+
+  template <typename Signature, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  class basic_unique_function;
+
+  /// \brief A move-only owning function wrapper, which is able to store
+  ///        callables of up to 4 pointers in size without allocating
+  template <typename Signature>
+  using unique_function
+    = basic_unique_function<Signature, 4u * sizeof(void*), alignof(void*), true>;
+
+  /// \brief A move-only owning function wrapper, which stores callables of
+  ///        up to \p Size bytes in an internal buffer, and never allocates
+  template <typename Signature,
+            std::size_t Size = 4u * sizeof(void*),
+            std::size_t Align = alignof(void*)>
+  using inplace_function = basic_unique_function<Signature, Size, Align, false>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A move-only, owning wrapper around a callable object
+  ///
+  /// Unlike \c std::function, the stored callable only needs to be
+  /// move-constructible, so closures that capture move-only state may be
+  /// stored.
+  ///
+  /// This uses the same small-buffer optimization as \c basic_any: the
+  /// callable is stored in the internal buffer if it fits within \p Size
+  /// bytes, is aligned to no more than \p Align, and is nothrow
+  /// move-constructible. Otherwise it is allocated, unless \p Allocates is
+  /// \c false -- in which case storing such a callable is ill-formed.
+  ///
+  /// Calling the function is a single indirect call; calling an empty
+  /// function throws \c std::bad_function_call.
+  ///
+  /// \tparam R the result type of the call
+  /// \tparam Args the argument types of the call
+  /// \tparam Size the size of the internal buffer
+  /// \tparam Align the alignment of the internal buffer
+  /// \tparam Allocates whether callables that do not fit the internal buffer
+  ///         may be allocated
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  class basic_unique_function<R(Args...),Size,Align,Allocates>
+  {
+    static_assert(
+      Align != 0u && (Align & (Align - 1u)) == 0u,
+      "Align must be a power of two"
+    );
+
+    // trait to determine if a callable may be stored in this function
+    template <typename Fn>
+    using is_storable = bool_constant<
+      is_move_constructible<Fn>::value &&
+      is_invocable_r<R,Fn&,Args...>::value
+    >;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a function that does not contain a callable
+    basic_unique_function() noexcept;
+
+    /// \brief Constructs a function that does not contain a callable
+    // cppcheck-suppress noExplicitConstructor
+    basic_unique_function(std::nullptr_t) noexcept;
+
+    /// \brief Moves the callable from \p other into this function
+    ///
+    /// \post \p other does not contain a callable
+    ///
+    /// \param other the other function to move
+    basic_unique_function(basic_unique_function&& other) noexcept;
+
+    basic_unique_function(const basic_unique_function&) = delete;
+
+    /// \brief Constructs this function from the callable \p fn
+    ///
+    /// If \p fn is a null function pointer or member pointer, this function
+    /// does not contain a callable.
+    ///
+    /// \param fn the callable to store
+    template <typename Fn,
+              typename=enable_if_t<!is_same<decay_t<Fn>,basic_unique_function>::value &&
+                                   is_storable<decay_t<Fn>>::value>>
+    // cppcheck-suppress noExplicitConstructor
+    basic_unique_function(Fn&& fn);
+
+    /// \brief Constructs the callable of type \p Fn in-place by forwarding
+    ///        \p args to its constructor
+    ///
+    /// \param args the arguments to forward to Fn's constructor
+    template <typename Fn, typename...UArgs,
+              typename=enable_if_t<is_constructible<Fn,UArgs...>::value &&
+                                   is_storable<Fn>::value>>
+    explicit basic_unique_function(in_place_type_t<Fn>, UArgs&&...args);
+
+    //--------------------------------------------------------------------------
+
+    ~basic_unique_function();
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Moves the callable from \p other into this function
+    ///
+    /// \post \p other does not contain a callable
+    ///
+    /// \param other the other function to move
+    /// \return reference to \c (*this)
+    basic_unique_function& operator=(basic_unique_function&& other) noexcept;
+
+    basic_unique_function& operator=(const basic_unique_function&) = delete;
+
+    /// \brief Destroys the callable in this function
+    ///
+    /// \return reference to \c (*this)
+    basic_unique_function& operator=(std::nullptr_t) noexcept;
+
+    /// \brief Replaces the callable in this function with \p fn
+    ///
+    /// \param fn the callable to store
+    /// \return reference to \c (*this)
+    template <typename Fn,
+              typename=enable_if_t<!is_same<decay_t<Fn>,basic_unique_function>::value &&
+                                   is_storable<decay_t<Fn>>::value>>
+    basic_unique_function& operator=(Fn&& fn);
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Swaps the callables of this function and \p other
+    ///
+    /// \param other the other function to swap with
+    void swap(basic_unique_function& other) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Checks whether this function contains a callable
+    ///
+    /// \return \c true if this function contains a callable
+    explicit operator bool() const noexcept;
+
+    /// \brief Invokes the stored callable with \p args
+    ///
+    /// \throw std::bad_function_call if this function is empty
+    /// \param args the arguments to forward to the callable
+    /// \return the result of the invocation
+    R operator()(Args...args);
+
+    //--------------------------------------------------------------------------
+    // Private Static Members / Types
+    //--------------------------------------------------------------------------
+  private:
+
+    // Internal buffer size + alignment
+    static constexpr auto buffer_size  = Size;
+    static constexpr auto buffer_align = Align;
+
+    // buffer (for internal storage)
+    using internal_buffer = typename aligned_storage<buffer_size,buffer_align>::type;
+
+    union storage
+    {
+      internal_buffer internal;
+      void*           external;
+    };
+
+    //--------------------------------------------------------------------------
+
+    // trait to determine if internal storage is required
+    template <typename T>
+    using requires_internal_storage = bool_constant<
+      (sizeof(T) <= buffer_size) &&
+      ((buffer_align % alignof(T)) == 0) &&
+      is_nothrow_move_constructible<T>::value
+    >;
+
+    //--------------------------------------------------------------------------
+
+    template <typename T>
+    struct internal_storage_handler;
+
+    template <typename T>
+    struct external_storage_handler;
+
+    template <typename T>
+    using storage_handler = conditional_t<
+      requires_internal_storage<T>::value,
+      internal_storage_handler<T>,
+      external_storage_handler<T>
+    >;
+
+    //--------------------------------------------------------------------------
+
+    enum class operation
+    {
+      destroy,  ///< Operation for calling the underlying's destructor
+      relocate, ///< Operation for moving the underlying, and destroying the
+                ///< source
+    };
+
+    //--------------------------------------------------------------------------
+
+    using storage_handler_ptr = void(*)(operation, storage*, storage*);
+    using invoker_type = R(*)(storage&, Args&&...);
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Constructs the callable of type \p T from \p args
+    ///
+    /// \param args the arguments to forward to \p T's constructor
+    template <typename T, typename...UArgs>
+    void construct(UArgs&&...args);
+
+    /// \{
+    /// \brief Checks whether \p fn is a null function or member pointer
+    ///
+    /// \param fn the callable to check
+    /// \return \c true if \p fn is null
+    template <typename Fn>
+    static bool is_null(const Fn& fn, true_type is_pointer) noexcept;
+    template <typename Fn>
+    static bool is_null(const Fn& fn, false_type is_pointer) noexcept;
+    /// \}
+
+    /// \brief The invoker for empty functions, which throws
+    ///        \c std::bad_function_call
+    static R invoke_empty(storage& s, Args&&...args);
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    storage             m_storage;
+    invoker_type        m_invoker;
+    storage_handler_ptr m_storage_handler;
+  };
+
+  //============================================================================
+  // non-member functions : class : basic_unique_function
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // utilities
+  //----------------------------------------------------------------------------
+
+  /// \brief Swaps the contents of \p lhs and \p rhs
+  template <typename Signature, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  void swap(basic_unique_function<Signature,Size,Align,Allocates>& lhs,
+            basic_unique_function<Signature,Size,Align,Allocates>& rhs) noexcept;
+
+  //----------------------------------------------------------------------------
+  // comparison
+  //----------------------------------------------------------------------------
+
+  /// \{
+  /// \brief Checks whether \p f is empty
+  template <typename Signature, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  bool operator==(const basic_unique_function<Signature,Size,Align,Allocates>& f,
+                  std::nullptr_t) noexcept;
+  template <typename Signature, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  bool operator==(std::nullptr_t,
+                  const basic_unique_function<Signature,Size,Align,Allocates>& f) noexcept;
+  template <typename Signature, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  bool operator!=(const basic_unique_function<Signature,Size,Align,Allocates>& f,
+                  std::nullptr_t) noexcept;
+  template <typename Signature, std::size_t Size, std::size_t Align,
+            bool Allocates>
+  bool operator!=(std::nullptr_t,
+                  const basic_unique_function<Signature,Size,Align,Allocates>& f) noexcept;
+  /// \}
+
   //============================================================================
   // struct : plus
   //============================================================================
@@ -659,6 +1115,325 @@ namespace bpstd {
     }
   };
 
+  //============================================================================
+  // Searchers
+  //============================================================================
+
+  namespace detail {
+
+    /// \brief Determines whether a skip table keyed on \p Key can be a flat
+    ///        array of every possible byte value
+    ///
+    /// This is only the case for single-byte integral keys that are hashed
+    /// and compared by value; any other hash or predicate may consider
+    /// distinct bytes equal, and so needs a hash table.
+    template <typename Key, typename Hash, typename BinaryPredicate>
+    struct is_byte_skip_table_key : bool_constant<
+      is_integral<Key>::value && sizeof(Key) == 1u &&
+      is_same<Hash,std::hash<Key>>::value &&
+      (is_same<BinaryPredicate,equal_to<>>::value ||
+       is_same<BinaryPredicate,equal_to<Key>>::value ||
+       is_same<BinaryPredicate,std::equal_to<Key>>::value)
+    >{};
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief A table of the distance that a search may skip, keyed on the
+    ///        character that was mismatched
+    ///
+    /// Keys that were never inserted map to the default distance.
+    //////////////////////////////////////////////////////////////////////////
+    template <typename Key, typename Value, typename Hash,
+              typename BinaryPredicate,
+              bool IsByte = is_byte_skip_table_key<Key,Hash,BinaryPredicate>::value>
+    class searcher_skip_table
+    {
+    public:
+
+      searcher_skip_table(Value default_value,
+                          std::size_t count,
+                          Hash hf,
+                          BinaryPredicate pred);
+
+      void insert(const Key& key, Value value);
+
+      Value operator[](const Key& key) const;
+
+    private:
+
+      std::unordered_map<Key,Value,Hash,BinaryPredicate> m_table;
+      Value m_default;
+    };
+
+    template <typename Key, typename Value, typename Hash,
+              typename BinaryPredicate>
+    class searcher_skip_table<Key,Value,Hash,BinaryPredicate,true>
+    {
+    public:
+
+      searcher_skip_table(Value default_value,
+                          std::size_t count,
+                          Hash hf,
+                          BinaryPredicate pred) noexcept;
+
+      void insert(const Key& key, Value value) noexcept;
+
+      Value operator[](const Key& key) const noexcept;
+
+    private:
+
+      Value m_table[256];
+    };
+
+  } // namespace detail
+
+  //============================================================================
+  // class : default_searcher
+  //============================================================================
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief A searcher that finds a pattern with std::search
+  ///
+  /// \tparam ForwardIt the iterator type of the pattern
+  /// \tparam BinaryPredicate the predicate that compares characters
+  ////////////////////////////////////////////////////////////////////////////
+  template <typename ForwardIt, typename BinaryPredicate = equal_to<>>
+  class default_searcher
+  {
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a searcher for the pattern [pat_first, pat_last)
+    ///
+    /// \param pat_first the start of the pattern
+    /// \param pat_last the end of the pattern
+    /// \param pred the predicate that compares characters
+    default_searcher(ForwardIt pat_first,
+                     ForwardIt pat_last,
+                     BinaryPredicate pred = BinaryPredicate());
+
+    //--------------------------------------------------------------------------
+    // Searching
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Finds the first occurrence of the pattern in [first, last)
+    ///
+    /// \param first the start of the range to search
+    /// \param last the end of the range to search
+    /// \return the matching range, or [last, last) if there is no match
+    template <typename ForwardIt2>
+    std::pair<ForwardIt2,ForwardIt2> operator()(ForwardIt2 first,
+                                                ForwardIt2 last) const;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    ForwardIt m_pattern_first;
+    ForwardIt m_pattern_last;
+    BinaryPredicate m_pred;
+  };
+
+  //============================================================================
+  // class : boyer_moore_horspool_searcher
+  //============================================================================
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief A searcher that finds a pattern with the Boyer-Moore-Horspool
+  ///        algorithm
+  ///
+  /// The skip table is built once on construction, so a searcher should be
+  /// reused when the same pattern is searched for in many ranges. Patterns
+  /// of single-byte characters compared by value use a flat table; any
+  /// others use a hash table.
+  ///
+  /// \tparam RandomIt the iterator type of the pattern
+  /// \tparam Hash the hash of the pattern's characters
+  /// \tparam BinaryPredicate the predicate that compares characters
+  ////////////////////////////////////////////////////////////////////////////
+  template <typename RandomIt,
+            typename Hash = std::hash<typename std::iterator_traits<RandomIt>::value_type>,
+            typename BinaryPredicate = equal_to<>>
+  class boyer_moore_horspool_searcher
+  {
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a searcher for the pattern [pat_first, pat_last)
+    ///
+    /// \param pat_first the start of the pattern
+    /// \param pat_last the end of the pattern
+    /// \param hf the hash of the pattern's characters
+    /// \param pred the predicate that compares characters
+    boyer_moore_horspool_searcher(RandomIt pat_first,
+                                  RandomIt pat_last,
+                                  Hash hf = Hash(),
+                                  BinaryPredicate pred = BinaryPredicate());
+
+    //--------------------------------------------------------------------------
+    // Searching
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Finds the first occurrence of the pattern in [first, last)
+    ///
+    /// \param first the start of the range to search
+    /// \param last the end of the range to search
+    /// \return the matching range, or [last, last) if there is no match
+    template <typename RandomIt2>
+    std::pair<RandomIt2,RandomIt2> operator()(RandomIt2 first,
+                                              RandomIt2 last) const;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+    using skip_table = detail::searcher_skip_table<value_type,difference_type,Hash,BinaryPredicate>;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    RandomIt m_pattern_first;
+    RandomIt m_pattern_last;
+    BinaryPredicate m_pred;
+    skip_table m_skip;
+  };
+
+  //============================================================================
+  // class : boyer_moore_searcher
+  //============================================================================
+
+  ////////////////////////////////////////////////////////////////////////////
+  /// \brief A searcher that finds a pattern with the Boyer-Moore algorithm
+  ///
+  /// In addition to the bad-character skip of Horspool, this also skips by
+  /// the good-suffix rule, which bounds the number of comparisons for
+  /// patterns with repetitive structure. Both tables are built once on
+  /// construction, and the good-suffix table takes one entry per pattern
+  /// character.
+  ///
+  /// \tparam RandomIt the iterator type of the pattern
+  /// \tparam Hash the hash of the pattern's characters
+  /// \tparam BinaryPredicate the predicate that compares characters
+  ////////////////////////////////////////////////////////////////////////////
+  template <typename RandomIt,
+            typename Hash = std::hash<typename std::iterator_traits<RandomIt>::value_type>,
+            typename BinaryPredicate = equal_to<>>
+  class boyer_moore_searcher
+  {
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a searcher for the pattern [pat_first, pat_last)
+    ///
+    /// \param pat_first the start of the pattern
+    /// \param pat_last the end of the pattern
+    /// \param hf the hash of the pattern's characters
+    /// \param pred the predicate that compares characters
+    boyer_moore_searcher(RandomIt pat_first,
+                         RandomIt pat_last,
+                         Hash hf = Hash(),
+                         BinaryPredicate pred = BinaryPredicate());
+
+    //--------------------------------------------------------------------------
+    // Searching
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Finds the first occurrence of the pattern in [first, last)
+    ///
+    /// \param first the start of the range to search
+    /// \param last the end of the range to search
+    /// \return the matching range, or [last, last) if there is no match
+    template <typename RandomIt2>
+    std::pair<RandomIt2,RandomIt2> operator()(RandomIt2 first,
+                                              RandomIt2 last) const;
+
+    //--------------------------------------------------------------------------
+    // Private Member Types
+    //--------------------------------------------------------------------------
+  private:
+
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    using difference_type = typename std::iterator_traits<RandomIt>::difference_type;
+    using skip_table = detail::searcher_skip_table<value_type,difference_type,Hash,BinaryPredicate>;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    RandomIt m_pattern_first;
+    RandomIt m_pattern_last;
+    BinaryPredicate m_pred;
+    skip_table m_skip;
+    std::vector<difference_type> m_suffix_skip;
+  };
+
+  //============================================================================
+  // non-member functions : searchers
+  //============================================================================
+
+  /// \brief Makes a default_searcher for the pattern [pat_first, pat_last)
+  ///
+  /// Class template argument deduction is not available before C++17, so
+  /// this deduces the searcher's iterator type instead.
+  ///
+  /// \param pat_first the start of the pattern
+  /// \param pat_last the end of the pattern
+  /// \param pred the predicate that compares characters
+  /// \return the searcher
+  template <typename ForwardIt, typename BinaryPredicate = equal_to<>>
+  default_searcher<ForwardIt,BinaryPredicate>
+    make_default_searcher(ForwardIt pat_first,
+                          ForwardIt pat_last,
+                          BinaryPredicate pred = BinaryPredicate());
+
+  /// \brief Makes a boyer_moore_horspool_searcher for the pattern
+  ///        [pat_first, pat_last)
+  ///
+  /// \param pat_first the start of the pattern
+  /// \param pat_last the end of the pattern
+  /// \param hf the hash of the pattern's characters
+  /// \param pred the predicate that compares characters
+  /// \return the searcher
+  template <typename RandomIt,
+            typename Hash = std::hash<typename std::iterator_traits<RandomIt>::value_type>,
+            typename BinaryPredicate = equal_to<>>
+  boyer_moore_horspool_searcher<RandomIt,Hash,BinaryPredicate>
+    make_boyer_moore_horspool_searcher(RandomIt pat_first,
+                                       RandomIt pat_last,
+                                       Hash hf = Hash(),
+                                       BinaryPredicate pred = BinaryPredicate());
+
+  /// \brief Makes a boyer_moore_searcher for the pattern [pat_first, pat_last)
+  ///
+  /// \param pat_first the start of the pattern
+  /// \param pat_last the end of the pattern
+  /// \param hf the hash of the pattern's characters
+  /// \param pred the predicate that compares characters
+  /// \return the searcher
+  template <typename RandomIt,
+            typename Hash = std::hash<typename std::iterator_traits<RandomIt>::value_type>,
+            typename BinaryPredicate = equal_to<>>
+  boyer_moore_searcher<RandomIt,Hash,BinaryPredicate>
+    make_boyer_moore_searcher(RandomIt pat_first,
+                              RandomIt pat_last,
+                              Hash hf = Hash(),
+                              BinaryPredicate pred = BinaryPredicate());
+
 } // namespace bpstd
 
 //==============================================================================
@@ -694,6 +1469,942 @@ bpstd::detail::not_fn_t<bpstd::decay_t<Fn>> bpstd::not_fn(Fn&& fn)
   return { bpstd::forward<Fn>(fn) };
 }
 
+//==============================================================================
+// definition : invoke_r
+//==============================================================================
+
+template <typename R, typename Fn, typename...Args>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::enable_if_t<!bpstd::is_void<R>::value,R>
+  bpstd::detail::invoke_r(Fn&& fn, Args&&...args)
+{
+  return detail::INVOKE(bpstd::forward<Fn>(fn), bpstd::forward<Args>(args)...);
+}
+
+template <typename R, typename Fn, typename...Args>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::enable_if_t<bpstd::is_void<R>::value,R>
+  bpstd::detail::invoke_r(Fn&& fn, Args&&...args)
+{
+  detail::INVOKE(bpstd::forward<Fn>(fn), bpstd::forward<Args>(args)...);
+}
+
+//==============================================================================
+// class : function_ref
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args>
+template <typename Fn, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::function_ref<R(Args...)>::function_ref(Fn&& fn)
+  noexcept
+  : m_storage{make_storage(is_function_pointer<Fn>{}, bpstd::forward<Fn>(fn))},
+    m_invoker{make_invoker<Fn>(is_function_pointer<Fn>{})}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+R bpstd::function_ref<R(Args...)>::operator()(Args...args)
+  const
+{
+  return m_invoker(m_storage, bpstd::forward<Args>(args)...);
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::function_ref<R(Args...)>::storage
+  bpstd::function_ref<R(Args...)>::make_storage(true_type, Fn&& fn)
+  noexcept
+{
+  auto result = storage{};
+  result.function = reinterpret_cast<void(*)()>(fn);
+  return result;
+}
+
+template <typename R, typename...Args>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::function_ref<R(Args...)>::storage
+  bpstd::function_ref<R(Args...)>::make_storage(false_type, Fn&& fn)
+  noexcept
+{
+  auto result = storage{};
+  result.object = const_cast<void*>(
+    static_cast<const volatile void*>(std::addressof(fn))
+  );
+  return result;
+}
+
+template <typename R, typename...Args>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::function_ref<R(Args...)>::invoker_type
+  bpstd::function_ref<R(Args...)>::make_invoker(true_type)
+  noexcept
+{
+  return &invoke_function<decay_t<Fn>>;
+}
+
+template <typename R, typename...Args>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::function_ref<R(Args...)>::invoker_type
+  bpstd::function_ref<R(Args...)>::make_invoker(false_type)
+  noexcept
+{
+  return &invoke_object<remove_reference_t<Fn>>;
+}
+
+template <typename R, typename...Args>
+template <typename Fn>
+inline
+R bpstd::function_ref<R(Args...)>::invoke_function(storage s, Args&&...args)
+{
+  return detail::invoke_r<R>(
+    reinterpret_cast<Fn>(s.function),
+    bpstd::forward<Args>(args)...
+  );
+}
+
+template <typename R, typename...Args>
+template <typename Fn>
+inline
+R bpstd::function_ref<R(Args...)>::invoke_object(storage s, Args&&...args)
+{
+  return detail::invoke_r<R>(
+    *static_cast<Fn*>(s.object),
+    bpstd::forward<Args>(args)...
+  );
+}
+
+//==============================================================================
+// class : basic_unique_function::internal_storage_handler
+//==============================================================================
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+struct bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::internal_storage_handler
+{
+  template <typename...UArgs>
+  static void construct(storage& s, UArgs&&...args);
+
+  static T& get(storage& s) noexcept;
+
+  static R invoke(storage& s, Args&&...args);
+
+  static void handle(operation op, storage* self, storage* other);
+};
+
+//==============================================================================
+// definition : class : basic_unique_function::internal_storage_handler
+//==============================================================================
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+template <typename...UArgs>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::internal_storage_handler<T>
+  ::construct(storage& s, UArgs&&...args)
+{
+  new (&s.internal) T(bpstd::forward<UArgs>(args)...);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+T& bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::internal_storage_handler<T>
+  ::get(storage& s)
+  noexcept
+{
+  // See the note in basic_any's internal_storage_handler for why this is
+  // converted directly to a T*
+  return *reinterpret_cast<T*>(&s.internal);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+inline
+R bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::internal_storage_handler<T>
+  ::invoke(storage& s, Args&&...args)
+{
+  return detail::invoke_r<R>(get(s), bpstd::forward<Args>(args)...);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+inline
+void bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::internal_storage_handler<T>
+  ::handle(operation op, storage* self, storage* other)
+{
+  assert(self != nullptr);
+
+  switch (op)
+  {
+    case operation::destroy:
+    {
+      BPSTD_UNUSED(other);
+
+      get(*self).~T();
+      break;
+    }
+
+    case operation::relocate:
+    {
+      assert(other != nullptr);
+
+      auto& source = get(*other);
+      construct(*self, bpstd::move(source));
+      source.~T();
+      break;
+    }
+  }
+}
+
+//==============================================================================
+// class : basic_unique_function::external_storage_handler
+//==============================================================================
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+struct bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::external_storage_handler
+{
+  template <typename...UArgs>
+  static void construct(storage& s, UArgs&&...args);
+
+  static T& get(storage& s) noexcept;
+
+  static R invoke(storage& s, Args&&...args);
+
+  static void handle(operation op, storage* self, storage* other);
+};
+
+//==============================================================================
+// definition : class : basic_unique_function::external_storage_handler
+//==============================================================================
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+template <typename...UArgs>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::external_storage_handler<T>
+  ::construct(storage& s, UArgs&&...args)
+{
+  s.external = new T(bpstd::forward<UArgs>(args)...);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+T& bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::external_storage_handler<T>
+  ::get(storage& s)
+  noexcept
+{
+  return *static_cast<T*>(s.external);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+inline
+R bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::external_storage_handler<T>
+  ::invoke(storage& s, Args&&...args)
+{
+  return detail::invoke_r<R>(get(s), bpstd::forward<Args>(args)...);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T>
+inline
+void bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::external_storage_handler<T>
+  ::handle(operation op, storage* self, storage* other)
+{
+  assert(self != nullptr);
+
+  switch (op)
+  {
+    case operation::destroy:
+    {
+      BPSTD_UNUSED(other);
+
+      delete static_cast<T*>(self->external);
+      break;
+    }
+
+    case operation::relocate:
+    {
+      assert(other != nullptr);
+
+      // The callable itself never moves; only ownership of it does
+      self->external = other->external;
+      break;
+    }
+  }
+}
+
+//==============================================================================
+// definitions : class : basic_unique_function
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::basic_unique_function()
+  noexcept
+  : m_storage{},
+    m_invoker{&invoke_empty},
+    m_storage_handler{nullptr}
+{
+
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::basic_unique_function(std::nullptr_t)
+  noexcept
+  : basic_unique_function{}
+{
+
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::basic_unique_function(basic_unique_function&& other)
+  noexcept
+  : m_storage{},
+    m_invoker{other.m_invoker},
+    m_storage_handler{other.m_storage_handler}
+{
+  if (m_storage_handler != nullptr) {
+    m_storage_handler(operation::relocate, &m_storage, &other.m_storage);
+    other.m_invoker = &invoke_empty;
+    other.m_storage_handler = nullptr;
+  }
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename Fn, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::basic_unique_function(Fn&& fn)
+  : basic_unique_function{}
+{
+  using is_pointer_type = bool_constant<
+    is_pointer<decay_t<Fn>>::value || is_member_pointer<decay_t<Fn>>::value
+  >;
+
+  if (!is_null(fn, is_pointer_type{})) {
+    construct<decay_t<Fn>>(bpstd::forward<Fn>(fn));
+  }
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename Fn, typename...UArgs, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::basic_unique_function(in_place_type_t<Fn>, UArgs&&...args)
+  : basic_unique_function{}
+{
+  construct<Fn>(bpstd::forward<UArgs>(args)...);
+}
+
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::~basic_unique_function()
+{
+  if (m_storage_handler != nullptr) {
+    m_storage_handler(operation::destroy, &m_storage, nullptr);
+  }
+}
+
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>&
+  bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::operator=(basic_unique_function&& other)
+  noexcept
+{
+  if (this != &other) {
+    if (m_storage_handler != nullptr) {
+      m_storage_handler(operation::destroy, &m_storage, nullptr);
+    }
+    m_invoker = other.m_invoker;
+    m_storage_handler = other.m_storage_handler;
+
+    if (m_storage_handler != nullptr) {
+      m_storage_handler(operation::relocate, &m_storage, &other.m_storage);
+      other.m_invoker = &invoke_empty;
+      other.m_storage_handler = nullptr;
+    }
+  }
+  return (*this);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>&
+  bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::operator=(std::nullptr_t)
+  noexcept
+{
+  basic_unique_function{}.swap(*this);
+  return (*this);
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename Fn, typename>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>&
+  bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::operator=(Fn&& fn)
+{
+  basic_unique_function{bpstd::forward<Fn>(fn)}.swap(*this);
+  return (*this);
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::swap(basic_unique_function& other)
+  noexcept
+{
+  using std::swap;
+
+  // Relocate through temporary storage, since either function may be empty
+  auto temp = storage{};
+  if (m_storage_handler != nullptr) {
+    m_storage_handler(operation::relocate, &temp, &m_storage);
+  }
+  if (other.m_storage_handler != nullptr) {
+    other.m_storage_handler(operation::relocate, &m_storage, &other.m_storage);
+  }
+  if (m_storage_handler != nullptr) {
+    m_storage_handler(operation::relocate, &other.m_storage, &temp);
+  }
+  swap(m_invoker, other.m_invoker);
+  swap(m_storage_handler, other.m_storage_handler);
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::operator bool()
+  const noexcept
+{
+  return m_storage_handler != nullptr;
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+R bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::operator()(Args...args)
+{
+  return m_invoker(m_storage, bpstd::forward<Args>(args)...);
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename T, typename...UArgs>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::construct(UArgs&&...args)
+{
+  static_assert(
+    Allocates || requires_internal_storage<T>::value,
+    "The callable must be nothrow move-constructible and fit within the "
+    "internal buffer of a function that does not allocate"
+  );
+
+  using handler = storage_handler<T>;
+
+  handler::construct(m_storage, bpstd::forward<UArgs>(args)...);
+  m_invoker = &handler::invoke;
+  m_storage_handler = &handler::handle;
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::is_null(const Fn& fn, true_type)
+  noexcept
+{
+  return fn == nullptr;
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::is_null(const Fn&, false_type)
+  noexcept
+{
+  return false;
+}
+
+template <typename R, typename...Args, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline
+R bpstd::basic_unique_function<R(Args...),Size,Align,Allocates>::invoke_empty(storage&, Args&&...)
+{
+  throw std::bad_function_call{};
+}
+
+//==============================================================================
+// non-member functions : class : basic_unique_function
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// utilities
+//------------------------------------------------------------------------------
+
+template <typename Signature, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::swap(basic_unique_function<Signature,Size,Align,Allocates>& lhs,
+                 basic_unique_function<Signature,Size,Align,Allocates>& rhs)
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+//------------------------------------------------------------------------------
+// comparison
+//------------------------------------------------------------------------------
+
+template <typename Signature, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator==(const basic_unique_function<Signature,Size,Align,Allocates>& f,
+                       std::nullptr_t)
+  noexcept
+{
+  return !static_cast<bool>(f);
+}
+
+template <typename Signature, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator==(std::nullptr_t,
+                       const basic_unique_function<Signature,Size,Align,Allocates>& f)
+  noexcept
+{
+  return !static_cast<bool>(f);
+}
+
+template <typename Signature, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator!=(const basic_unique_function<Signature,Size,Align,Allocates>& f,
+                       std::nullptr_t)
+  noexcept
+{
+  return static_cast<bool>(f);
+}
+
+template <typename Signature, std::size_t Size, std::size_t Align,
+          bool Allocates>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::operator!=(std::nullptr_t,
+                       const basic_unique_function<Signature,Size,Align,Allocates>& f)
+  noexcept
+{
+  return static_cast<bool>(f);
+}
+
+//==============================================================================
+// class : detail::searcher_skip_table
+//==============================================================================
+
+template <typename Key, typename Value, typename Hash, typename BinaryPredicate,
+          bool IsByte>
+inline
+bpstd::detail::searcher_skip_table<Key,Value,Hash,BinaryPredicate,IsByte>
+  ::searcher_skip_table(Value default_value,
+                        std::size_t count,
+                        Hash hf,
+                        BinaryPredicate pred)
+  : m_table(count, bpstd::move(hf), bpstd::move(pred)),
+    m_default{default_value}
+{
+
+}
+
+template <typename Key, typename Value, typename Hash, typename BinaryPredicate,
+          bool IsByte>
+inline
+void bpstd::detail::searcher_skip_table<Key,Value,Hash,BinaryPredicate,IsByte>
+  ::insert(const Key& key, Value value)
+{
+  m_table[key] = value;
+}
+
+template <typename Key, typename Value, typename Hash, typename BinaryPredicate,
+          bool IsByte>
+inline
+Value bpstd::detail::searcher_skip_table<Key,Value,Hash,BinaryPredicate,IsByte>
+  ::operator[](const Key& key)
+  const
+{
+  const auto it = m_table.find(key);
+  return (it == m_table.end()) ? m_default : it->second;
+}
+
+//------------------------------------------------------------------------------
+
+template <typename Key, typename Value, typename Hash, typename BinaryPredicate>
+inline
+bpstd::detail::searcher_skip_table<Key,Value,Hash,BinaryPredicate,true>
+  ::searcher_skip_table(Value default_value,
+                        std::size_t count,
+                        Hash hf,
+                        BinaryPredicate pred)
+  noexcept
+{
+  BPSTD_UNUSED(count);
+  BPSTD_UNUSED(hf);
+  BPSTD_UNUSED(pred);
+
+  for (auto& value : m_table) {
+    value = default_value;
+  }
+}
+
+template <typename Key, typename Value, typename Hash, typename BinaryPredicate>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::searcher_skip_table<Key,Value,Hash,BinaryPredicate,true>
+  ::insert(const Key& key, Value value)
+  noexcept
+{
+  m_table[static_cast<unsigned char>(key)] = value;
+}
+
+template <typename Key, typename Value, typename Hash, typename BinaryPredicate>
+inline BPSTD_INLINE_VISIBILITY
+Value bpstd::detail::searcher_skip_table<Key,Value,Hash,BinaryPredicate,true>
+  ::operator[](const Key& key)
+  const noexcept
+{
+  return m_table[static_cast<unsigned char>(key)];
+}
+
+//==============================================================================
+// class : default_searcher
+//==============================================================================
+
+template <typename ForwardIt, typename BinaryPredicate>
+inline
+bpstd::default_searcher<ForwardIt,BinaryPredicate>
+  ::default_searcher(ForwardIt pat_first,
+                     ForwardIt pat_last,
+                     BinaryPredicate pred)
+  : m_pattern_first{pat_first},
+    m_pattern_last{pat_last},
+    m_pred(bpstd::move(pred))
+{
+
+}
+
+template <typename ForwardIt, typename BinaryPredicate>
+template <typename ForwardIt2>
+inline
+std::pair<ForwardIt2,ForwardIt2>
+  bpstd::default_searcher<ForwardIt,BinaryPredicate>
+  ::operator()(ForwardIt2 first, ForwardIt2 last)
+  const
+{
+  const auto it = std::search(first, last,
+                              m_pattern_first, m_pattern_last,
+                              m_pred);
+  if (it == last) {
+    return {last, last};
+  }
+  auto end = it;
+  std::advance(end, std::distance(m_pattern_first, m_pattern_last));
+  return {it, end};
+}
+
+//==============================================================================
+// class : boyer_moore_horspool_searcher
+//==============================================================================
+
+template <typename RandomIt, typename Hash, typename BinaryPredicate>
+inline
+bpstd::boyer_moore_horspool_searcher<RandomIt,Hash,BinaryPredicate>
+  ::boyer_moore_horspool_searcher(RandomIt pat_first,
+                                  RandomIt pat_last,
+                                  Hash hf,
+                                  BinaryPredicate pred)
+  : m_pattern_first{pat_first},
+    m_pattern_last{pat_last},
+    m_pred(pred),
+    m_skip{
+      pat_last - pat_first,
+      static_cast<std::size_t>(pat_last - pat_first),
+      bpstd::move(hf),
+      bpstd::move(pred)
+    }
+{
+  // Each character skips to the last occurrence of itself in the pattern,
+  // excluding the final character
+  const auto size = pat_last - pat_first;
+  for (auto i = difference_type{0}; i < size - 1; ++i) {
+    m_skip.insert(pat_first[i], size - 1 - i);
+  }
+}
+
+template <typename RandomIt, typename Hash, typename BinaryPredicate>
+template <typename RandomIt2>
+inline
+std::pair<RandomIt2,RandomIt2>
+  bpstd::boyer_moore_horspool_searcher<RandomIt,Hash,BinaryPredicate>
+  ::operator()(RandomIt2 first, RandomIt2 last)
+  const
+{
+  using result_difference_type = typename std::iterator_traits<RandomIt2>::difference_type;
+
+  const auto size = static_cast<result_difference_type>(m_pattern_last - m_pattern_first);
+  if (size == 0) {
+    return {first, first};
+  }
+  if (last - first < size) {
+    return {last, last};
+  }
+
+  const auto& pattern_back = m_pattern_first[size - 1];
+  const auto last_start = last - size;
+  auto it = first;
+  while (true) {
+    const auto& back = it[size - 1];
+    if (m_pred(back, pattern_back)) {
+      auto i = size - 1;
+      while (i > 0 && m_pred(it[i - 1], m_pattern_first[i - 1])) {
+        --i;
+      }
+      if (i == 0) {
+        return {it, it + size};
+      }
+    }
+    const auto skip = static_cast<result_difference_type>(m_skip[back]);
+    if (last_start - it < skip) {
+      break;
+    }
+    it += skip;
+  }
+  return {last, last};
+}
+
+//==============================================================================
+// class : boyer_moore_searcher
+//==============================================================================
+
+template <typename RandomIt, typename Hash, typename BinaryPredicate>
+inline
+bpstd::boyer_moore_searcher<RandomIt,Hash,BinaryPredicate>
+  ::boyer_moore_searcher(RandomIt pat_first,
+                         RandomIt pat_last,
+                         Hash hf,
+                         BinaryPredicate pred)
+  : m_pattern_first{pat_first},
+    m_pattern_last{pat_last},
+    m_pred(pred),
+    m_skip{
+      pat_last - pat_first,
+      static_cast<std::size_t>(pat_last - pat_first),
+      bpstd::move(hf),
+      bpstd::move(pred)
+    },
+    m_suffix_skip(static_cast<std::size_t>(pat_last - pat_first))
+{
+  const auto size = pat_last - pat_first;
+  if (size == 0) {
+    return;
+  }
+
+  // The bad-character table is the same as Horspool's
+  for (auto i = difference_type{0}; i < size - 1; ++i) {
+    m_skip.insert(pat_first[i], size - 1 - i);
+  }
+
+  // suffix[i] is the length of the longest substring ending at i that is
+  // also a suffix of the pattern (Charras and Lecroq, "Handbook of Exact
+  // String Matching Algorithms", 2004)
+  auto suffix = std::vector<difference_type>(static_cast<std::size_t>(size));
+  const auto at = [](std::vector<difference_type>& v, difference_type i)
+    -> difference_type&
+  {
+    return v[static_cast<std::size_t>(i)];
+  };
+
+  at(suffix, size - 1) = size;
+  auto f = difference_type{0};
+  auto g = size - 1;
+  for (auto i = size - 2; i >= 0; --i) {
+    if (i > g && at(suffix, i + size - 1 - f) < i - g) {
+      at(suffix, i) = at(suffix, i + size - 1 - f);
+    } else {
+      if (i < g) {
+        g = i;
+      }
+      f = i;
+      while (g >= 0 && m_pred(pat_first[g], pat_first[g + size - 1 - f])) {
+        --g;
+      }
+      at(suffix, i) = f - g;
+    }
+  }
+
+  // A mismatch at i skips to the next occurrence of the matched suffix, or
+  // else to the longest prefix of the pattern that is also a suffix of it
+  for (auto& skip : m_suffix_skip) {
+    skip = size;
+  }
+  auto j = difference_type{0};
+  for (auto i = size - 1; i >= 0; --i) {
+    if (at(suffix, i) == i + 1) {
+      for (; j < size - 1 - i; ++j) {
+        if (at(m_suffix_skip, j) == size) {
+          at(m_suffix_skip, j) = size - 1 - i;
+        }
+      }
+    }
+  }
+  for (auto i = difference_type{0}; i < size - 1; ++i) {
+    at(m_suffix_skip, size - 1 - at(suffix, i)) = size - 1 - i;
+  }
+}
+
+template <typename RandomIt, typename Hash, typename BinaryPredicate>
+template <typename RandomIt2>
+inline
+std::pair<RandomIt2,RandomIt2>
+  bpstd::boyer_moore_searcher<RandomIt,Hash,BinaryPredicate>
+  ::operator()(RandomIt2 first, RandomIt2 last)
+  const
+{
+  using result_difference_type = typename std::iterator_traits<RandomIt2>::difference_type;
+
+  const auto size = static_cast<result_difference_type>(m_pattern_last - m_pattern_first);
+  if (size == 0) {
+    return {first, first};
+  }
+  if (last - first < size) {
+    return {last, last};
+  }
+
+  const auto last_start = last - size;
+  auto it = first;
+  while (true) {
+    auto i = size - 1;
+    while (m_pred(it[i], m_pattern_first[i])) {
+      if (i == 0) {
+        return {it, it + size};
+      }
+      --i;
+    }
+
+    // The bad-character skip is relative to the end of the pattern, so it
+    // is adjusted to the position of the mismatch
+    const auto bad_skip = static_cast<result_difference_type>(m_skip[it[i]]) - (size - 1 - i);
+    const auto suffix_skip = static_cast<result_difference_type>(
+      m_suffix_skip[static_cast<std::size_t>(i)]
+    );
+    const auto skip = (bad_skip > suffix_skip) ? bad_skip : suffix_skip;
+    if (last_start - it < skip) {
+      break;
+    }
+    it += skip;
+  }
+  return {last, last};
+}
+
+//==============================================================================
+// non-member functions : searchers
+//==============================================================================
+
+template <typename ForwardIt, typename BinaryPredicate>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::default_searcher<ForwardIt,BinaryPredicate>
+  bpstd::make_default_searcher(ForwardIt pat_first,
+                               ForwardIt pat_last,
+                               BinaryPredicate pred)
+{
+  return default_searcher<ForwardIt,BinaryPredicate>{
+    pat_first, pat_last, bpstd::move(pred)
+  };
+}
+
+template <typename RandomIt, typename Hash, typename BinaryPredicate>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::boyer_moore_horspool_searcher<RandomIt,Hash,BinaryPredicate>
+  bpstd::make_boyer_moore_horspool_searcher(RandomIt pat_first,
+                                            RandomIt pat_last,
+                                            Hash hf,
+                                            BinaryPredicate pred)
+{
+  return boyer_moore_horspool_searcher<RandomIt,Hash,BinaryPredicate>{
+    pat_first, pat_last, bpstd::move(hf), bpstd::move(pred)
+  };
+}
+
+template <typename RandomIt, typename Hash, typename BinaryPredicate>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::boyer_moore_searcher<RandomIt,Hash,BinaryPredicate>
+  bpstd::make_boyer_moore_searcher(RandomIt pat_first,
+                                   RandomIt pat_last,
+                                   Hash hf,
+                                   BinaryPredicate pred)
+{
+  return boyer_moore_searcher<RandomIt,Hash,BinaryPredicate>{
+    pat_first, pat_last, bpstd::move(hf), bpstd::move(pred)
+  };
+}
+
 BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
 
 #endif /* BPSTD_FUNCTIONAL_HPP */
@@ -0,0 +1,602 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file mapped_file.hpp
+///
+/// \brief This header provides a read-only view of a memory-mapped file
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_MAPPED_FILE_HPP
+#define BPSTD_MAPPED_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "string_view.hpp" // string_view
+#include "span.hpp"        // span, as_bytes
+#include "cstddef.hpp"     // byte
+
+#include <cstddef>      // std::size_t
+#include <cstdint>      // std::uintmax_t
+#include <cerrno>       // errno
+#include <string>       // std::string
+#include <stdexcept>    // std::out_of_range
+#include <system_error> // std::system_error, std::generic_category
+
+// Memory-mapping is only implemented through POSIX. On other platforms this
+// header is empty, and BPSTD_HAS_MAPPED_FILE is 0.
+#if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h> // _POSIX_MAPPED_FILES
+#endif
+
+#if defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0)
+# define BPSTD_HAS_MAPPED_FILE 1
+#else
+# define BPSTD_HAS_MAPPED_FILE 0
+#endif
+
+#if BPSTD_HAS_MAPPED_FILE
+
+#include <fcntl.h>    // ::open
+#include <sys/mman.h> // ::mmap, ::munmap, ::posix_madvise
+#include <sys/stat.h> // ::fstat
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // class : mapped_file
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A read-only memory-mapping of an entire file
+  ///
+  /// The contents of the file are paged in by the operating system as they
+  /// are accessed, rather than being read up-front, and are viewed through
+  /// \c string_view or \c span<const byte> without being copied.
+  ///
+  /// The mapping is private, so changes made to the file while it is mapped
+  /// may or may not be visible through the mapping. Truncating the file while
+  /// it is mapped causes accesses beyond the new end to fault.
+  //////////////////////////////////////////////////////////////////////////////
+  class mapped_file
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using size_type = std::size_t;
+
+    /// \brief Advice on how a range of the file will be accessed
+    ///
+    /// Advice is only a hint for the operating system's paging, and never
+    /// changes the contents of the mapping.
+    enum class access_advice
+    {
+      normal,     ///< No particular access pattern
+      sequential, ///< Accessed in order; read ahead aggressively
+      random,     ///< Accessed in no particular order; do not read ahead
+      will_need,  ///< Accessed soon; start reading it in now
+      dont_need,  ///< Not accessed soon; its pages may be released
+    };
+
+    //--------------------------------------------------------------------------
+    // Constructors / Destructor / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a mapped_file that does not map anything
+    mapped_file() noexcept;
+
+    /// \{
+    /// \brief Maps the file at \p path
+    ///
+    /// \throw std::system_error if the file cannot be opened or mapped
+    /// \param path the path to the file
+    /// \param advice the advice for accessing the whole file
+    explicit mapped_file(const char* path,
+                         access_advice advice = access_advice::normal);
+    explicit mapped_file(const std::string& path,
+                         access_advice advice = access_advice::normal);
+    /// \}
+
+    /// \brief Moves the mapping from \p other
+    ///
+    /// \param other the other mapped_file to move
+    mapped_file(mapped_file&& other) noexcept;
+    mapped_file(const mapped_file&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Unmaps the file
+    ~mapped_file();
+
+    //--------------------------------------------------------------------------
+
+    /// \brief Unmaps this file, and moves the mapping from \p other
+    ///
+    /// \param other the other mapped_file to move
+    /// \return reference to \c (*this)
+    mapped_file& operator=(mapped_file&& other) noexcept;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Unmaps the current file, if any, and maps the file at \p path
+    ///
+    /// If this throws, this mapped_file no longer maps anything.
+    ///
+    /// \throw std::system_error if the file cannot be opened or mapped
+    /// \param path the path to the file
+    /// \param advice the advice for accessing the whole file
+    void open(const char* path, access_advice advice = access_advice::normal);
+    void open(const std::string& path,
+              access_advice advice = access_advice::normal);
+    /// \}
+
+    /// \brief Unmaps the file, if any
+    void close() noexcept;
+
+    /// \brief Swaps the mappings of this mapped_file and \p other
+    ///
+    /// \param other the other mapped_file to swap with
+    void swap(mapped_file& other) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Queries whether this mapped_file maps a file
+    ///
+    /// \note an empty file is still considered open
+    /// \return true if a file has been mapped
+    bool is_open() const noexcept;
+
+    /// \brief Gets the size of the mapped file, in bytes
+    ///
+    /// \return the size of the file
+    size_type size() const noexcept;
+
+    /// \brief Queries whether the mapped file has no contents
+    ///
+    /// \return true if size() is 0
+    bool empty() const noexcept;
+
+    /// \brief Gets a pointer to the start of the mapped file
+    ///
+    /// \return a pointer to the contents, or nullptr if the file is empty
+    const char* data() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Views
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Views the contents of the file, or the range of at most
+    ///        \p count bytes starting at \p pos
+    ///
+    /// The view is only valid until the file is unmapped.
+    ///
+    /// \throw std::out_of_range if \p pos is greater than size()
+    /// \param pos the offset to start the view at
+    /// \param count the maximum length of the view
+    /// \return the view of the contents
+    string_view view() const noexcept;
+    string_view view(size_type pos, size_type count = string_view::npos) const;
+    /// \}
+
+    /// \{
+    /// \brief Views the contents of the file as bytes, or the range of at
+    ///        most \p count bytes starting at \p pos
+    ///
+    /// The view is only valid until the file is unmapped.
+    ///
+    /// \throw std::out_of_range if \p pos is greater than size()
+    /// \param pos the offset to start the view at
+    /// \param count the maximum length of the view
+    /// \return the view of the contents
+    span<const byte> bytes() const noexcept;
+    span<const byte> bytes(size_type pos, size_type count = string_view::npos) const;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Paging
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Advises the operating system on how the whole file, or the
+    ///        range of at most \p count bytes starting at \p pos, will be
+    ///        accessed
+    ///
+    /// Ranges are widened outwards to whole pages. Advice is best-effort, so
+    /// it is silently ignored if the operating system rejects it, and ranges
+    /// beyond the end of the file are ignored.
+    ///
+    /// \param advice the advice
+    /// \param pos the offset to start the range at
+    /// \param count the maximum length of the range
+    void advise(access_advice advice) noexcept;
+    void advise(access_advice advice,
+                size_type pos,
+                size_type count = string_view::npos) noexcept;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Private Static Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Throws a std::system_error for the error \p error
+    ///
+    /// \param error the errno value
+    /// \param what the operation that failed
+    [[noreturn]] static void throw_system_error(int error, const char* what);
+
+    /// \brief Converts \p advice to the equivalent posix_madvise advice
+    ///
+    /// \param advice the advice
+    /// \return the posix_madvise advice
+    static int to_posix_advice(access_advice advice) noexcept;
+
+    /// \brief Gets the size of a page of virtual memory
+    ///
+    /// \return the page size
+    static size_type page_size() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    const char* m_data;
+    size_type m_size;
+    bool m_is_open;
+  };
+
+  //============================================================================
+  // non-member functions : class : mapped_file
+  //============================================================================
+
+  /// \brief Swaps the mappings of \p lhs and \p rhs
+  ///
+  /// \param lhs the left mapped_file to swap
+  /// \param rhs the right mapped_file to swap
+  void swap(mapped_file& lhs, mapped_file& rhs) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// class : mapped_file
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Destructor / Assignment
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::mapped_file::mapped_file()
+  noexcept
+  : m_data{nullptr},
+    m_size{0u},
+    m_is_open{false}
+{
+
+}
+
+inline
+bpstd::mapped_file::mapped_file(const char* path, access_advice advice)
+  : mapped_file{}
+{
+  open(path, advice);
+}
+
+inline
+bpstd::mapped_file::mapped_file(const std::string& path, access_advice advice)
+  : mapped_file{path.c_str(), advice}
+{
+
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::mapped_file::mapped_file(mapped_file&& other)
+  noexcept
+  : m_data{other.m_data},
+    m_size{other.m_size},
+    m_is_open{other.m_is_open}
+{
+  other.m_data = nullptr;
+  other.m_size = 0u;
+  other.m_is_open = false;
+}
+
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::mapped_file::~mapped_file()
+{
+  close();
+}
+
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::mapped_file& bpstd::mapped_file::operator=(mapped_file&& other)
+  noexcept
+{
+  auto temp = mapped_file{static_cast<mapped_file&&>(other)};
+  swap(temp);
+  return (*this);
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+inline
+void bpstd::mapped_file::open(const char* path, access_advice advice)
+{
+  close();
+
+  const auto fd = ::open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    throw_system_error(errno, "bpstd::mapped_file: unable to open file");
+  }
+
+  struct ::stat status;
+  if (::fstat(fd, &status) != 0) {
+    const auto error = errno;
+    ::close(fd);
+    throw_system_error(error, "bpstd::mapped_file: unable to query file size");
+  }
+
+  const auto file_size = static_cast<std::uintmax_t>(status.st_size);
+  if (file_size > static_cast<std::uintmax_t>(static_cast<size_type>(-1))) {
+    ::close(fd);
+    throw_system_error(EFBIG, "bpstd::mapped_file: file is too large to map");
+  }
+  const auto size = static_cast<size_type>(file_size);
+
+  // Mapping 0 bytes is an error, so empty files are left unmapped
+  auto* data = static_cast<void*>(nullptr);
+  if (size != 0u) {
+    data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      const auto error = errno;
+      ::close(fd);
+      throw_system_error(error, "bpstd::mapped_file: unable to map file");
+    }
+  }
+
+  // The mapping holds its own reference to the file
+  ::close(fd);
+
+  m_data = static_cast<const char*>(data);
+  m_size = size;
+  m_is_open = true;
+
+  if (advice != access_advice::normal) {
+    advise(advice);
+  }
+}
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::mapped_file::open(const std::string& path, access_advice advice)
+{
+  open(path.c_str(), advice);
+}
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::mapped_file::close()
+  noexcept
+{
+  if (m_data != nullptr) {
+    ::munmap(const_cast<char*>(m_data), m_size);
+  }
+  m_data = nullptr;
+  m_size = 0u;
+  m_is_open = false;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::mapped_file::swap(mapped_file& other)
+  noexcept
+{
+  const auto data = m_data;
+  const auto size = m_size;
+  const auto is_open = m_is_open;
+
+  m_data = other.m_data;
+  m_size = other.m_size;
+  m_is_open = other.m_is_open;
+
+  other.m_data = data;
+  other.m_size = size;
+  other.m_is_open = is_open;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::mapped_file::is_open()
+  const noexcept
+{
+  return m_is_open;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::mapped_file::size_type bpstd::mapped_file::size()
+  const noexcept
+{
+  return m_size;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::mapped_file::empty()
+  const noexcept
+{
+  return m_size == 0u;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+const char* bpstd::mapped_file::data()
+  const noexcept
+{
+  return m_data;
+}
+
+//------------------------------------------------------------------------------
+// Views
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::string_view bpstd::mapped_file::view()
+  const noexcept
+{
+  return string_view{m_data, m_size};
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::string_view bpstd::mapped_file::view(size_type pos, size_type count)
+  const
+{
+  if (pos > m_size) {
+    throw std::out_of_range{"bpstd::mapped_file::view: pos out of range"};
+  }
+  const auto remaining = m_size - pos;
+
+  return string_view{m_data + pos, count < remaining ? count : remaining};
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::span<const bpstd::byte> bpstd::mapped_file::bytes()
+  const noexcept
+{
+  return as_bytes(span<const char>{m_data, m_size});
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::span<const bpstd::byte>
+  bpstd::mapped_file::bytes(size_type pos, size_type count)
+  const
+{
+  const auto v = view(pos, count);
+
+  return as_bytes(span<const char>{v.data(), v.size()});
+}
+
+//------------------------------------------------------------------------------
+// Paging
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::mapped_file::advise(access_advice advice)
+  noexcept
+{
+  advise(advice, 0u, m_size);
+}
+
+inline
+void bpstd::mapped_file::advise(access_advice advice,
+                                size_type pos,
+                                size_type count)
+  noexcept
+{
+  if (pos >= m_size || count == 0u) {
+    return;
+  }
+  const auto remaining = m_size - pos;
+  const auto length = count < remaining ? count : remaining;
+
+  // The mapping itself is page-aligned, so only the start needs rounding down
+  const auto offset = pos % page_size();
+
+  ::posix_madvise(
+    const_cast<char*>(m_data + (pos - offset)),
+    length + offset,
+    to_posix_advice(advice)
+  );
+}
+
+//------------------------------------------------------------------------------
+// Private Static Functions
+//------------------------------------------------------------------------------
+
+inline
+void bpstd::mapped_file::throw_system_error(int error, const char* what)
+{
+  throw std::system_error{error, std::generic_category(), what};
+}
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::mapped_file::to_posix_advice(access_advice advice)
+  noexcept
+{
+  switch (advice) {
+    case access_advice::sequential: return POSIX_MADV_SEQUENTIAL;
+    case access_advice::random:     return POSIX_MADV_RANDOM;
+    case access_advice::will_need:  return POSIX_MADV_WILLNEED;
+    case access_advice::dont_need:  return POSIX_MADV_DONTNEED;
+    case access_advice::normal:     break;
+  }
+  return POSIX_MADV_NORMAL;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::mapped_file::size_type bpstd::mapped_file::page_size()
+  noexcept
+{
+  static const auto s_page_size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+
+  return s_page_size;
+}
+
+//==============================================================================
+// non-member functions : class : mapped_file
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::swap(mapped_file& lhs, mapped_file& rhs)
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_HAS_MAPPED_FILE */
+
+#endif /* BPSTD_MAPPED_FILE_HPP */
@@ -220,7 +220,7 @@ namespace bpstd {
     auto to_address_impl(const T& p, std::true_type)
       -> decltype(std::pointer_traits<T>::to_address(std::declval<const T&>()))
     {
-      return to_address(std::pointer_traits<T>::to_address(p));
+      return bpstd::to_address(std::pointer_traits<T>::to_address(p));
     }
 
     template <typename T>
@@ -228,7 +228,7 @@ namespace bpstd {
     auto to_address_impl(const T& p, std::false_type)
       -> decltype(std::declval<const T&>().operator->())
     {
-      return to_address(p.operator->());
+      return bpstd::to_address(p.operator->());
     }
 
   } // namespace detail
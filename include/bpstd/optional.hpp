@@ -58,6 +58,16 @@ namespace bpstd {
     // trait : is_optional
     //==========================================================================
 
+    template <typename T>
+    struct is_optional : false_type{};
+
+    template <typename T>
+    struct is_optional<optional<T>> : true_type{};
+
+    /// \brief A tag used to construct an optional's value directly from the
+    ///        result of invoking a function
+    struct optional_invoke_t{};
+
     template <typename T, typename U>
     using optional_is_convertible = conjunction<
       std::is_constructible<T, optional<U>&>,
@@ -159,6 +169,66 @@ namespace bpstd {
   // class : optional
   //=========================================================================
 
+  //=========================================================================
+  // trait : optional_sentinel_traits
+  //=========================================================================
+
+  ///////////////////////////////////////////////////////////////////////////
+  /// \brief An opt-in customization point that allows an optional<T> to
+  ///        store its disengaged state as an invalid value of \p T, rather
+  ///        than as a separate flag
+  ///
+  /// This allows optional<T> to be exactly \c sizeof(T). By default this
+  /// trait is not defined, and optional<T> stores a separate flag.
+  ///
+  /// A specialization must provide the following static functions:
+  ///
+  /// \code
+  /// // Returns the value that represents a disengaged optional
+  /// static constexpr T sentinel() noexcept;
+  ///
+  /// // Checks whether the value is the sentinel
+  /// static constexpr bool is_sentinel(const T& value) noexcept;
+  /// \endcode
+  ///
+  /// For example, an index type that never legitimately holds \c -1 may
+  /// declare:
+  ///
+  /// \code
+  /// namespace bpstd {
+  ///   template <>
+  ///   struct optional_sentinel_traits<index>
+  ///   {
+  ///     static constexpr index sentinel() noexcept { return index{-1}; }
+  ///     static constexpr bool is_sentinel(const index& i) noexcept
+  ///     {
+  ///       return i.value == -1;
+  ///     }
+  ///   };
+  /// } // namespace bpstd
+  /// \endcode
+  ///
+  /// \note \p T must be trivially destructible, and the sentinel must never
+  ///       be stored as an engaged value -- doing so is undefined behavior.
+  ///
+  /// \tparam T the type to provide a sentinel for
+  ///////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct optional_sentinel_traits;
+
+  namespace detail {
+
+    template <typename T, typename = void>
+    struct has_optional_sentinel : false_type{};
+
+    template <typename T>
+    struct has_optional_sentinel<T,void_t<decltype(
+      static_cast<void>(optional_sentinel_traits<T>::sentinel()),
+      optional_sentinel_traits<T>::is_sentinel(std::declval<const T&>())
+    )>> : true_type{};
+
+  } // namespace detail
+
   namespace detail {
 
     template <typename T, bool IsTrivial> class optional_base;
@@ -177,6 +247,9 @@ namespace bpstd {
       constexpr optional_base(in_place_t, Args&&...args)
         noexcept(std::is_nothrow_constructible<T,Args...>::value);
 
+      template <typename Fn, typename Arg>
+      constexpr optional_base(optional_invoke_t, Fn&& fn, Arg&& arg);
+
       optional_base(optional_base&& other) = default;
       optional_base(const optional_base& other) = default;
 
@@ -218,6 +291,9 @@ namespace bpstd {
         template <typename...Args>
         constexpr storage_type(in_place_t, Args&&...args)
           : something(bpstd::forward<Args>(args)...){}
+        template <typename Fn, typename Arg>
+        constexpr storage_type(optional_invoke_t, Fn&& fn, Arg&& arg)
+          : something(bpstd::invoke(bpstd::forward<Fn>(fn), bpstd::forward<Arg>(arg))){}
         constexpr storage_type() : nothing(){}
       };
 
@@ -245,6 +321,9 @@ namespace bpstd {
       optional_base(in_place_t, Args&&...args)
         noexcept(std::is_nothrow_constructible<T,Args...>::value);
 
+      template <typename Fn, typename Arg>
+      optional_base(optional_invoke_t, Fn&& fn, Arg&& arg);
+
       optional_base(optional_base&& other) = default;
       optional_base(const optional_base& other) = default;
 
@@ -288,6 +367,9 @@ namespace bpstd {
         template <typename...Args>
         storage_type(in_place_t, Args&&...args)
           : something(bpstd::forward<Args>(args)...){}
+        template <typename Fn, typename Arg>
+        storage_type(optional_invoke_t, Fn&& fn, Arg&& arg)
+          : something(bpstd::invoke(bpstd::forward<Fn>(fn), bpstd::forward<Arg>(arg))){}
         storage_type() : nothing(){}
         ~storage_type(){}
       };
@@ -300,6 +382,82 @@ namespace bpstd {
       storage_type m_storage;
       bool         m_engaged;
     };
+
+    /////////////////////////////////////////////////////////////////////////
+    /// \brief The storage for an optional whose type provides a sentinel
+    ///        through optional_sentinel_traits
+    ///
+    /// The disengaged state is represented by the sentinel value itself, so
+    /// no separate flag is stored.
+    /////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class optional_sentinel_base
+    {
+      static_assert(
+        std::is_trivially_destructible<T>::value,
+        "optional_sentinel_traits may only be specialized for "
+        "trivially destructible types"
+      );
+
+      using traits_type = optional_sentinel_traits<T>;
+
+      //---------------------------------------------------------------------
+      // Constructors / Assignment
+      //---------------------------------------------------------------------
+    public:
+      // cppcheck-suppress noExplicitConstructor
+      constexpr optional_sentinel_base(nullopt_t) noexcept;
+
+      template <typename...Args>
+      constexpr optional_sentinel_base(in_place_t, Args&&...args)
+        noexcept(std::is_nothrow_constructible<T,Args...>::value);
+
+      template <typename Fn, typename Arg>
+      constexpr optional_sentinel_base(optional_invoke_t, Fn&& fn, Arg&& arg);
+
+      optional_sentinel_base(optional_sentinel_base&& other) = default;
+      optional_sentinel_base(const optional_sentinel_base& other) = default;
+
+      //---------------------------------------------------------------------
+
+      optional_sentinel_base& operator=(optional_sentinel_base&& other) = default;
+      optional_sentinel_base& operator=(const optional_sentinel_base& other) = default;
+
+      //---------------------------------------------------------------------
+      // Protected Observers
+      //---------------------------------------------------------------------
+    protected:
+
+      BPSTD_CPP14_CONSTEXPR T* val() noexcept;
+      constexpr const T* val() const noexcept;
+
+      constexpr bool contains_value() const noexcept;
+
+      //---------------------------------------------------------------------
+      // Protected Modifiers
+      //---------------------------------------------------------------------
+    protected:
+
+      template <typename...Args>
+      void construct(Args&&...args);
+
+      void destruct();
+
+      //---------------------------------------------------------------------
+      // Private Members
+      //---------------------------------------------------------------------
+    private:
+
+      T m_storage;
+    };
+
+    template <typename T>
+    using optional_base_t = conditional_t<
+      has_optional_sentinel<T>::value,
+      optional_sentinel_base<T>,
+      optional_base<T,std::is_trivially_destructible<T>::value>
+    >;
+
   } // namespace detail
 
   ///////////////////////////////////////////////////////////////////////////
@@ -338,7 +496,7 @@ namespace bpstd {
   ///////////////////////////////////////////////////////////////////////////
   template <typename T>
   class optional
-    : detail::optional_base<T,std::is_trivially_destructible<T>::value>
+    : detail::optional_base_t<T>
   {
     static_assert(
       !std::is_void<T>::value,
@@ -353,7 +511,7 @@ namespace bpstd {
       "optional of an abstract-type is ill-formed"
     );
 
-    using base_type = detail::optional_base<T,std::is_trivially_destructible<T>::value>;
+    using base_type = detail::optional_base_t<T>;
 
     //-----------------------------------------------------------------------
     // Public Member Types
@@ -732,6 +890,68 @@ namespace bpstd {
     BPSTD_CPP14_CONSTEXPR value_type value_or(U&& default_value) &&;
     /// \}
 
+    //-----------------------------------------------------------------------
+    // Monadic Operations
+    //-----------------------------------------------------------------------
+
+    /// \{
+    /// \brief Invokes \p fn with the contained value, if any, and returns
+    ///        the optional it produces
+    ///
+    /// \param fn a function that accepts the value, and returns an optional
+    /// \return the result of \p fn, or an empty optional if \c *this is
+    ///         empty
+    template <typename Fn>
+    BPSTD_CPP14_CONSTEXPR remove_cvref_t<invoke_result_t<Fn,T&>>
+      and_then(Fn&& fn) &;
+    template <typename Fn>
+    BPSTD_CPP14_CONSTEXPR remove_cvref_t<invoke_result_t<Fn,T&&>>
+      and_then(Fn&& fn) &&;
+    template <typename Fn>
+    constexpr remove_cvref_t<invoke_result_t<Fn,const T&>>
+      and_then(Fn&& fn) const &;
+    template <typename Fn>
+    constexpr remove_cvref_t<invoke_result_t<Fn,const T&&>>
+      and_then(Fn&& fn) const &&;
+    /// \}
+
+    /// \{
+    /// \brief Invokes \p fn with the contained value, if any, and returns an
+    ///        optional containing its result
+    ///
+    /// The result of \p fn is constructed directly into the returned
+    /// optional, and is not copied or moved.
+    ///
+    /// \param fn a function that accepts the value
+    /// \return an optional containing the result of \p fn, or an empty
+    ///         optional if \c *this is empty
+    template <typename Fn>
+    BPSTD_CPP14_CONSTEXPR optional<remove_cv_t<invoke_result_t<Fn,T&>>>
+      transform(Fn&& fn) &;
+    template <typename Fn>
+    BPSTD_CPP14_CONSTEXPR optional<remove_cv_t<invoke_result_t<Fn,T&&>>>
+      transform(Fn&& fn) &&;
+    template <typename Fn>
+    constexpr optional<remove_cv_t<invoke_result_t<Fn,const T&>>>
+      transform(Fn&& fn) const &;
+    template <typename Fn>
+    constexpr optional<remove_cv_t<invoke_result_t<Fn,const T&&>>>
+      transform(Fn&& fn) const &&;
+    /// \}
+
+    /// \{
+    /// \brief Returns \c *this if it contains a value, otherwise returns
+    ///        the optional produced by \p fn
+    ///
+    /// \param fn a function that accepts no arguments, and returns an
+    ///           optional<T>
+    /// \return \c *this, or the result of \p fn
+    template <typename Fn>
+    constexpr optional or_else(Fn&& fn) const &;
+    template <typename Fn>
+    BPSTD_CPP14_CONSTEXPR optional or_else(Fn&& fn) &&;
+    /// \}
+
     //-----------------------------------------------------------------------
     // Modifiers
     //-----------------------------------------------------------------------
@@ -766,6 +986,21 @@ namespace bpstd {
     /// \param args the arguments to pass to the constructor
     template <typename U,typename...Args >
     void emplace(std::initializer_list<U> ilist, Args&&...args);
+
+    //-----------------------------------------------------------------------
+    // Private Constructors
+    //-----------------------------------------------------------------------
+  private:
+
+    /// \brief Constructs the contained value from the result of invoking
+    ///        \p fn with \p arg
+    ///
+    /// \param fn the function to invoke
+    /// \param arg the argument to the function
+    template <typename Fn, typename Arg>
+    constexpr optional(detail::optional_invoke_t, Fn&& fn, Arg&& arg);
+
+    template <typename> friend class optional;
   };
 
   //=========================================================================
@@ -909,6 +1144,17 @@ bpstd::detail::optional_base<T,true>::optional_base(in_place_t, Args&&...args)
 
 }
 
+template <typename T>
+template <typename Fn, typename Arg>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::optional_base<T,true>
+  ::optional_base(optional_invoke_t, Fn&& fn, Arg&& arg)
+  : m_storage(optional_invoke_t{}, bpstd::forward<Fn>(fn), bpstd::forward<Arg>(arg)),
+    m_engaged{true}
+{
+
+}
+
 //-----------------------------------------------------------------------------
 // Protected Observers
 //-----------------------------------------------------------------------------
@@ -946,7 +1192,7 @@ template <typename...Args>
 inline BPSTD_INLINE_VISIBILITY
 void bpstd::detail::optional_base<T,true>::construct(Args&&...args)
 {
-  m_storage.something = T(bpstd::forward<Args>(args)...);
+  new (&m_storage.something) T(bpstd::forward<Args>(args)...);
   m_engaged = true;
 }
 
@@ -987,6 +1233,17 @@ bpstd::detail::optional_base<T,false>
 
 }
 
+template <typename T>
+template <typename Fn, typename Arg>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::detail::optional_base<T,false>
+  ::optional_base(optional_invoke_t, Fn&& fn, Arg&& arg)
+  : m_storage(optional_invoke_t{}, bpstd::forward<Fn>(fn), bpstd::forward<Arg>(arg)),
+    m_engaged{true}
+{
+
+}
+
 //-----------------------------------------------------------------------------
 
 template <typename T>
@@ -1050,6 +1307,92 @@ void bpstd::detail::optional_base<T,false>::destruct()
   }
 }
 
+//=============================================================================
+// class : detail::optional_sentinel_base
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::optional_sentinel_base<T>
+  ::optional_sentinel_base(nullopt_t)
+  noexcept
+  : m_storage(traits_type::sentinel())
+{
+}
+
+template <typename T>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::optional_sentinel_base<T>
+  ::optional_sentinel_base(in_place_t, Args&&...args)
+  noexcept(std::is_nothrow_constructible<T,Args...>::value)
+  : m_storage(bpstd::forward<Args>(args)...)
+{
+
+}
+
+template <typename T>
+template <typename Fn, typename Arg>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::detail::optional_sentinel_base<T>
+  ::optional_sentinel_base(optional_invoke_t, Fn&& fn, Arg&& arg)
+  : m_storage(bpstd::invoke(bpstd::forward<Fn>(fn), bpstd::forward<Arg>(arg)))
+{
+
+}
+
+//-----------------------------------------------------------------------------
+// Protected Observers
+//-----------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+T* bpstd::detail::optional_sentinel_base<T>::val()
+  noexcept
+{
+  return &m_storage;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+const T* bpstd::detail::optional_sentinel_base<T>::val()
+  const noexcept
+{
+  return &m_storage;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::detail::optional_sentinel_base<T>::contains_value()
+  const noexcept
+{
+  return !traits_type::is_sentinel(m_storage);
+}
+
+//-----------------------------------------------------------------------------
+// Protected Modifiers
+//-----------------------------------------------------------------------------
+
+template <typename T>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::optional_sentinel_base<T>::construct(Args&&...args)
+{
+  // 'T' is trivially destructible, so the sentinel can be overwritten in place
+  new (&m_storage) T(bpstd::forward<Args>(args)...);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::detail::optional_sentinel_base<T>::destruct()
+{
+  m_storage = traits_type::sentinel();
+}
+
 //=============================================================================
 // class : optional
 //=============================================================================
@@ -1198,6 +1541,15 @@ bpstd::optional<T>::optional(U&& value)
 
 }
 
+template <typename T>
+template <typename Fn, typename Arg>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::optional<T>::optional(detail::optional_invoke_t, Fn&& fn, Arg&& arg)
+  : base_type{ detail::optional_invoke_t{}, bpstd::forward<Fn>(fn), bpstd::forward<Arg>(arg) }
+{
+
+}
+
 //-----------------------------------------------------------------------------
 
 template <typename T>
@@ -1404,7 +1756,171 @@ typename bpstd::optional<T>::value_type
   bpstd::optional<T>::value_or(U&& default_value)
   &&
 {
-  return bool(*this) ? (*base_type::val()) : bpstd::forward<U>(default_value);
+  return bool(*this) ? bpstd::move(*base_type::val()) : bpstd::forward<U>(default_value);
+}
+
+//-----------------------------------------------------------------------------
+// Monadic Operations
+//-----------------------------------------------------------------------------
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::remove_cvref_t<bpstd::invoke_result_t<Fn,T&>>
+  bpstd::optional<T>::and_then(Fn&& fn)
+  &
+{
+  using result_type = remove_cvref_t<invoke_result_t<Fn,T&>>;
+
+  static_assert(
+    detail::is_optional<result_type>::value,
+    "Fn must return an optional"
+  );
+
+  return bool(*this)
+    ? bpstd::invoke(bpstd::forward<Fn>(fn), *base_type::val())
+    : result_type{};
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::remove_cvref_t<bpstd::invoke_result_t<Fn,T&&>>
+  bpstd::optional<T>::and_then(Fn&& fn)
+  &&
+{
+  using result_type = remove_cvref_t<invoke_result_t<Fn,T&&>>;
+
+  static_assert(
+    detail::is_optional<result_type>::value,
+    "Fn must return an optional"
+  );
+
+  return bool(*this)
+    ? bpstd::invoke(bpstd::forward<Fn>(fn), bpstd::move(*base_type::val()))
+    : result_type{};
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::remove_cvref_t<bpstd::invoke_result_t<Fn,const T&>>
+  bpstd::optional<T>::and_then(Fn&& fn)
+  const &
+{
+  static_assert(
+    detail::is_optional<remove_cvref_t<invoke_result_t<Fn,const T&>>>::value,
+    "Fn must return an optional"
+  );
+
+  return bool(*this)
+    ? bpstd::invoke(bpstd::forward<Fn>(fn), *base_type::val())
+    : remove_cvref_t<invoke_result_t<Fn,const T&>>{};
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::remove_cvref_t<bpstd::invoke_result_t<Fn,const T&&>>
+  bpstd::optional<T>::and_then(Fn&& fn)
+  const &&
+{
+  static_assert(
+    detail::is_optional<remove_cvref_t<invoke_result_t<Fn,const T&&>>>::value,
+    "Fn must return an optional"
+  );
+
+  return bool(*this)
+    ? bpstd::invoke(bpstd::forward<Fn>(fn), bpstd::move(*base_type::val()))
+    : remove_cvref_t<invoke_result_t<Fn,const T&&>>{};
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::optional<bpstd::remove_cv_t<bpstd::invoke_result_t<Fn,T&>>>
+  bpstd::optional<T>::transform(Fn&& fn)
+  &
+{
+  using result_type = optional<remove_cv_t<invoke_result_t<Fn,T&>>>;
+
+  return bool(*this)
+    ? result_type{detail::optional_invoke_t{}, bpstd::forward<Fn>(fn), *base_type::val()}
+    : result_type{};
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::optional<bpstd::remove_cv_t<bpstd::invoke_result_t<Fn,T&&>>>
+  bpstd::optional<T>::transform(Fn&& fn)
+  &&
+{
+  using result_type = optional<remove_cv_t<invoke_result_t<Fn,T&&>>>;
+
+  return bool(*this)
+    ? result_type{detail::optional_invoke_t{}, bpstd::forward<Fn>(fn), bpstd::move(*base_type::val())}
+    : result_type{};
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::optional<bpstd::remove_cv_t<bpstd::invoke_result_t<Fn,const T&>>>
+  bpstd::optional<T>::transform(Fn&& fn)
+  const &
+{
+  return bool(*this)
+    ? optional<remove_cv_t<invoke_result_t<Fn,const T&>>>{
+        detail::optional_invoke_t{}, bpstd::forward<Fn>(fn), *base_type::val()
+      }
+    : optional<remove_cv_t<invoke_result_t<Fn,const T&>>>{};
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::optional<bpstd::remove_cv_t<bpstd::invoke_result_t<Fn,const T&&>>>
+  bpstd::optional<T>::transform(Fn&& fn)
+  const &&
+{
+  return bool(*this)
+    ? optional<remove_cv_t<invoke_result_t<Fn,const T&&>>>{
+        detail::optional_invoke_t{}, bpstd::forward<Fn>(fn), bpstd::move(*base_type::val())
+      }
+    : optional<remove_cv_t<invoke_result_t<Fn,const T&&>>>{};
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::optional<T> bpstd::optional<T>::or_else(Fn&& fn)
+  const &
+{
+  static_assert(
+    std::is_same<remove_cvref_t<invoke_result_t<Fn>>,optional>::value,
+    "Fn must return an optional<T>"
+  );
+
+  return bool(*this) ? *this : bpstd::invoke(bpstd::forward<Fn>(fn));
+}
+
+template <typename T>
+template <typename Fn>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::optional<T> bpstd::optional<T>::or_else(Fn&& fn)
+  &&
+{
+  static_assert(
+    std::is_same<remove_cvref_t<invoke_result_t<Fn>>,optional>::value,
+    "Fn must return an optional<T>"
+  );
+
+  return bool(*this) ? bpstd::move(*this) : bpstd::invoke(bpstd::forward<Fn>(fn));
 }
 
 //-----------------------------------------------------------------------------
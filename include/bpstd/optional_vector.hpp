@@ -0,0 +1,785 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file optional_vector.hpp
+///
+/// \brief This header provides a column-oriented sequence of optional values
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_OPTIONAL_VECTOR_HPP
+#define BPSTD_OPTIONAL_VECTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "optional.hpp"    // optional, nullopt_t, bad_optional_access
+#include "span.hpp"        // span
+#include "type_traits.hpp" // is_same
+#include "utility.hpp"     // forward, move
+
+#include <vector>           // std::vector
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t
+#include <initializer_list> // std::initializer_list
+#include <cassert>          // assert
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    //==========================================================================
+    // Bit Utilities
+    //==========================================================================
+
+    /// \brief Counts the number of set bits in \p x
+    ///
+    /// \param x the word to count
+    /// \return the number of set bits
+    BPSTD_CPP14_CONSTEXPR int popcount64(std::uint64_t x) noexcept;
+
+    /// \brief Counts the number of trailing zero bits in \p x
+    ///
+    /// \pre \p x is not 0
+    /// \param x the word to count
+    /// \return the index of the lowest set bit
+    BPSTD_CPP14_CONSTEXPR int countr_zero64(std::uint64_t x) noexcept;
+
+  } // namespace detail
+
+  //============================================================================
+  // class : optional_vector
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A sequence of optional values, stored column-wise
+  ///
+  /// Unlike a \c std::vector<optional<T>>, the values are stored contiguously
+  /// without per-element padding, and the presence of each value is stored
+  /// separately in a packed bitset. This allows the values to be viewed as a
+  /// single \c span<T>, and allows the present values to be found 64 at a
+  /// time.
+  ///
+  /// Slots that do not contain a value hold a value-initialized \p T, so
+  /// \p T must be default-constructible.
+  ///
+  /// \tparam T the underlying type
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class optional_vector
+  {
+    static_assert(
+      !is_same<T,bool>::value,
+      "optional_vector<bool> is ill-formed, since std::vector<bool> is not "
+      "contiguous"
+    );
+
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs an empty optional_vector
+    optional_vector() noexcept;
+
+    /// \brief Constructs an optional_vector of \p count elements that do not
+    ///        contain values
+    ///
+    /// \param count the number of elements
+    explicit optional_vector(size_type count);
+
+    /// \brief Constructs an optional_vector from the optionals in \p ilist
+    ///
+    /// \param ilist the optionals to copy
+    optional_vector(std::initializer_list<optional<T>> ilist);
+
+    optional_vector(optional_vector&& other) = default;
+    optional_vector(const optional_vector& other) = default;
+
+    //--------------------------------------------------------------------------
+
+    optional_vector& operator=(optional_vector&& other) = default;
+    optional_vector& operator=(const optional_vector& other) = default;
+
+    //--------------------------------------------------------------------------
+    // Capacity
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the number of elements, including those without values
+    ///
+    /// \return the number of elements
+    size_type size() const noexcept;
+
+    /// \brief Checks whether this optional_vector has no elements
+    ///
+    /// \return \c true if there are no elements
+    bool empty() const noexcept;
+
+    /// \brief Counts the number of elements that contain a value
+    ///
+    /// \return the number of values
+    size_type count() const noexcept;
+
+    /// \brief Reserves storage for at least \p capacity elements
+    ///
+    /// \param capacity the number of elements to reserve
+    void reserve(size_type capacity);
+
+    //--------------------------------------------------------------------------
+    // Element Access
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Checks whether the element at \p index contains a value
+    ///
+    /// \pre \p index is less than \ref size()
+    /// \param index the index of the element
+    /// \return \c true if the element contains a value
+    bool has_value(size_type index) const noexcept;
+
+    /// \{
+    /// \brief Gets the value of the element at \p index
+    ///
+    /// \pre \p index is less than \ref size()
+    /// \throw bad_optional_access if the element does not contain a value
+    /// \param index the index of the element
+    /// \return reference to the value
+    reference value(size_type index);
+    const_reference value(size_type index) const;
+    /// \}
+
+    /// \brief Gets a copy of the element at \p index as an optional
+    ///
+    /// \pre \p index is less than \ref size()
+    /// \param index the index of the element
+    /// \return the element
+    optional<T> get(size_type index) const;
+
+    /// \{
+    /// \brief Gets a view of every value slot, including those of elements
+    ///        that do not contain a value
+    ///
+    /// \return a span of the values
+    span<T> values() noexcept;
+    span<const T> values() const noexcept;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Modifiers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \{
+    /// \brief Appends an element containing \p value
+    ///
+    /// \param value the value to append
+    void push_back(const T& value);
+    void push_back(T&& value);
+    /// \}
+
+    /// \{
+    /// \brief Appends an element containing the value of \p value, if any
+    ///
+    /// \param value the optional to append
+    void push_back(const optional<T>& value);
+    void push_back(optional<T>&& value);
+    /// \}
+
+    /// \brief Appends an element containing a value constructed from \p args
+    ///
+    /// \param args the arguments to forward to T's constructor
+    /// \return reference to the constructed value
+    template <typename...Args>
+    reference emplace_back(Args&&...args);
+
+    /// \brief Removes the last element
+    ///
+    /// \pre this optional_vector is not empty
+    void pop_back();
+
+    /// \{
+    /// \brief Sets the element at \p index to contain \p value
+    ///
+    /// \pre \p index is less than \ref size()
+    /// \param index the index of the element
+    /// \param value the value to set
+    void set(size_type index, const T& value);
+    void set(size_type index, T&& value);
+    /// \}
+
+    /// \brief Resets the element at \p index so that it does not contain a
+    ///        value
+    ///
+    /// The value slot is reset to a value-initialized \p T.
+    ///
+    /// \pre \p index is less than \ref size()
+    /// \param index the index of the element
+    void reset(size_type index);
+
+    /// \brief Resizes this optional_vector to contain \p count elements
+    ///
+    /// New elements do not contain values.
+    ///
+    /// \param count the new number of elements
+    void resize(size_type count);
+
+    /// \brief Removes every element
+    void clear() noexcept;
+
+    /// \brief Swaps the contents of this optional_vector with \p other
+    ///
+    /// \param other the other optional_vector to swap with
+    void swap(optional_vector& other) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Scanning
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Finds the index of the first element at or after \p pos that
+    ///        contains a value
+    ///
+    /// The presence bits are scanned a word -- 64 elements -- at a time.
+    ///
+    /// \param pos the index to start searching from
+    /// \return the index of the element, or \ref size() if there is none
+    size_type find_next(size_type pos = 0u) const noexcept;
+
+    /// \{
+    /// \brief Invokes \p fn with the index and value of each element that
+    ///        contains a value, in order
+    ///
+    /// \param fn the function to invoke, as if by fn(index, value)
+    template <typename Fn>
+    void for_each_value(Fn&& fn);
+    template <typename Fn>
+    void for_each_value(Fn&& fn) const;
+    /// \}
+
+    //--------------------------------------------------------------------------
+    // Private Static Members
+    //--------------------------------------------------------------------------
+  private:
+
+    static constexpr size_type bits_per_word = 64u;
+
+    /// \brief Gets the number of words required for \p count elements
+    static constexpr size_type word_count(size_type count) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Ensures a presence word exists for one more element
+    void grow_presence();
+
+    /// \brief Marks the element at \p index as containing a value
+    void set_present(size_type index) noexcept;
+
+    /// \brief Marks the element at \p index as not containing a value
+    void clear_present(size_type index) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    // The presence bits may contain trailing words beyond those needed for
+    // size(), but every bit for an index >= size() is always zero
+    std::vector<T>             m_values;
+    std::vector<std::uint64_t> m_presence;
+  };
+
+  //============================================================================
+  // non-member functions : class : optional_vector
+  //============================================================================
+
+  //----------------------------------------------------------------------------
+  // utilities
+  //----------------------------------------------------------------------------
+
+  /// \brief Swaps the contents of \p lhs and \p rhs
+  template <typename T>
+  void swap(optional_vector<T>& lhs, optional_vector<T>& rhs) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// Bit Utilities
+//==============================================================================
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::popcount64(std::uint64_t x)
+  noexcept
+{
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_popcountll(x);
+#else
+  x = x - ((x >> 1u) & 0x5555555555555555ull);
+  x = (x & 0x3333333333333333ull) + ((x >> 2u) & 0x3333333333333333ull);
+  x = (x + (x >> 4u)) & 0x0f0f0f0f0f0f0f0full;
+  return static_cast<int>((x * 0x0101010101010101ull) >> 56u);
+#endif
+}
+
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+int bpstd::detail::countr_zero64(std::uint64_t x)
+  noexcept
+{
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_ctzll(x);
+#else
+  // Isolate the lowest set bit, and count the bits below it
+  return popcount64((x & (~x + 1u)) - 1u);
+#endif
+}
+
+//==============================================================================
+// class : optional_vector
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::optional_vector<T>::optional_vector()
+  noexcept
+  : m_values{},
+    m_presence{}
+{
+
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::optional_vector<T>::optional_vector(size_type count)
+  : m_values(count),
+    m_presence(word_count(count), 0u)
+{
+
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::optional_vector<T>::optional_vector(std::initializer_list<optional<T>> ilist)
+  : optional_vector{}
+{
+  reserve(ilist.size());
+  for (const auto& value : ilist) {
+    push_back(value);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Capacity
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::optional_vector<T>::size_type
+  bpstd::optional_vector<T>::size()
+  const noexcept
+{
+  return m_values.size();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::optional_vector<T>::empty()
+  const noexcept
+{
+  return m_values.empty();
+}
+
+template <typename T>
+inline
+typename bpstd::optional_vector<T>::size_type
+  bpstd::optional_vector<T>::count()
+  const noexcept
+{
+  auto result = size_type{0u};
+  for (auto word : m_presence) {
+    result += static_cast<size_type>(detail::popcount64(word));
+  }
+  return result;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::reserve(size_type capacity)
+{
+  m_values.reserve(capacity);
+  m_presence.reserve(word_count(capacity));
+}
+
+//------------------------------------------------------------------------------
+// Element Access
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bool bpstd::optional_vector<T>::has_value(size_type index)
+  const noexcept
+{
+  assert(index < size());
+
+  const auto word = m_presence[index / bits_per_word];
+  return ((word >> (index % bits_per_word)) & 1u) != 0u;
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::optional_vector<T>::reference
+  bpstd::optional_vector<T>::value(size_type index)
+{
+  if (!has_value(index)) {
+    throw bad_optional_access{};
+  }
+  return m_values[index];
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::optional_vector<T>::const_reference
+  bpstd::optional_vector<T>::value(size_type index)
+  const
+{
+  if (!has_value(index)) {
+    throw bad_optional_access{};
+  }
+  return m_values[index];
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::optional<T> bpstd::optional_vector<T>::get(size_type index)
+  const
+{
+  if (!has_value(index)) {
+    return nullopt;
+  }
+  return m_values[index];
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::span<T> bpstd::optional_vector<T>::values()
+  noexcept
+{
+  return span<T>{m_values.data(), m_values.size()};
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+bpstd::span<const T> bpstd::optional_vector<T>::values()
+  const noexcept
+{
+  return span<const T>{m_values.data(), m_values.size()};
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::push_back(const T& value)
+{
+  emplace_back(value);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::push_back(T&& value)
+{
+  emplace_back(bpstd::move(value));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::push_back(const optional<T>& value)
+{
+  if (value.has_value()) {
+    emplace_back(*value);
+  } else {
+    grow_presence();
+    m_values.emplace_back();
+  }
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::push_back(optional<T>&& value)
+{
+  if (value.has_value()) {
+    emplace_back(bpstd::move(*value));
+  } else {
+    grow_presence();
+    m_values.emplace_back();
+  }
+}
+
+template <typename T>
+template <typename...Args>
+inline BPSTD_INLINE_VISIBILITY
+typename bpstd::optional_vector<T>::reference
+  bpstd::optional_vector<T>::emplace_back(Args&&...args)
+{
+  grow_presence();
+  m_values.emplace_back(bpstd::forward<Args>(args)...);
+  set_present(m_values.size() - 1u);
+
+  return m_values.back();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::pop_back()
+{
+  assert(!empty());
+
+  clear_present(m_values.size() - 1u);
+  m_values.pop_back();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::set(size_type index, const T& value)
+{
+  assert(index < size());
+
+  m_values[index] = value;
+  set_present(index);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::set(size_type index, T&& value)
+{
+  assert(index < size());
+
+  m_values[index] = bpstd::move(value);
+  set_present(index);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::reset(size_type index)
+{
+  assert(index < size());
+
+  clear_present(index);
+  m_values[index] = T();
+}
+
+template <typename T>
+inline
+void bpstd::optional_vector<T>::resize(size_type count)
+{
+  if (count < m_values.size()) {
+    // Clear the presence of every removed element, so that no bit at or
+    // beyond size() is ever set
+    const auto first_word = count / bits_per_word;
+    const auto last_word  = word_count(m_values.size());
+    const auto offset     = count % bits_per_word;
+
+    if (offset != 0u) {
+      m_presence[first_word] &= (std::uint64_t{1u} << offset) - 1u;
+    } else {
+      m_presence[first_word] = 0u;
+    }
+    for (auto i = first_word + 1u; i < last_word; ++i) {
+      m_presence[i] = 0u;
+    }
+  } else {
+    m_presence.resize(word_count(count), 0u);
+  }
+  m_values.resize(count);
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::clear()
+  noexcept
+{
+  m_values.clear();
+  m_presence.clear();
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::swap(optional_vector& other)
+  noexcept
+{
+  m_values.swap(other.m_values);
+  m_presence.swap(other.m_presence);
+}
+
+//------------------------------------------------------------------------------
+// Scanning
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline
+typename bpstd::optional_vector<T>::size_type
+  bpstd::optional_vector<T>::find_next(size_type pos)
+  const noexcept
+{
+  if (pos >= size()) {
+    return size();
+  }
+
+  const auto words = word_count(size());
+  auto i = pos / bits_per_word;
+  auto word = m_presence[i] & (~std::uint64_t{0u} << (pos % bits_per_word));
+
+  while (word == 0u) {
+    if (++i == words) {
+      return size();
+    }
+    word = m_presence[i];
+  }
+  return (i * bits_per_word) + static_cast<size_type>(detail::countr_zero64(word));
+}
+
+template <typename T>
+template <typename Fn>
+inline
+void bpstd::optional_vector<T>::for_each_value(Fn&& fn)
+{
+  const auto words = word_count(size());
+
+  for (auto i = size_type{0u}; i < words; ++i) {
+    // Visit each set bit, clearing the lowest one at each step
+    for (auto word = m_presence[i]; word != 0u; word &= (word - 1u)) {
+      const auto index = (i * bits_per_word) +
+                         static_cast<size_type>(detail::countr_zero64(word));
+      fn(index, m_values[index]);
+    }
+  }
+}
+
+template <typename T>
+template <typename Fn>
+inline
+void bpstd::optional_vector<T>::for_each_value(Fn&& fn)
+  const
+{
+  const auto words = word_count(size());
+
+  for (auto i = size_type{0u}; i < words; ++i) {
+    for (auto word = m_presence[i]; word != 0u; word &= (word - 1u)) {
+      const auto index = (i * bits_per_word) +
+                         static_cast<size_type>(detail::countr_zero64(word));
+      fn(index, m_values[index]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Private Static Members
+//------------------------------------------------------------------------------
+
+template <typename T>
+constexpr typename bpstd::optional_vector<T>::size_type
+  bpstd::optional_vector<T>::bits_per_word;
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::optional_vector<T>::size_type
+  bpstd::optional_vector<T>::word_count(size_type count)
+  noexcept
+{
+  return (count + bits_per_word - 1u) / bits_per_word;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::grow_presence()
+{
+  // If appending the value later throws, the extra word is left zeroed,
+  // which is harmless
+  const auto words = word_count(m_values.size() + 1u);
+  if (m_presence.size() < words) {
+    m_presence.push_back(0u);
+  }
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::set_present(size_type index)
+  noexcept
+{
+  m_presence[index / bits_per_word] |=
+    (std::uint64_t{1u} << (index % bits_per_word));
+}
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::optional_vector<T>::clear_present(size_type index)
+  noexcept
+{
+  m_presence[index / bits_per_word] &=
+    ~(std::uint64_t{1u} << (index % bits_per_word));
+}
+
+//==============================================================================
+// non-member functions : class : optional_vector
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// utilities
+//------------------------------------------------------------------------------
+
+template <typename T>
+inline BPSTD_INLINE_VISIBILITY
+void bpstd::swap(optional_vector<T>& lhs, optional_vector<T>& rhs)
+  noexcept
+{
+  lhs.swap(rhs);
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_OPTIONAL_VECTOR_HPP */
@@ -0,0 +1,311 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file record_reader.hpp
+///
+/// \brief This header provides a buffered reader of delimited records from a
+///        file descriptor
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_RECORD_READER_HPP
+#define BPSTD_RECORD_READER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "string_view.hpp" // string_view
+#include "optional.hpp"    // optional, nullopt
+
+#include <cstddef>      // std::size_t
+#include <cstring>      // std::memmove, std::memcpy
+#include <cerrno>       // errno, EINTR
+#include <memory>       // std::unique_ptr
+#include <utility>      // std::move
+#include <system_error> // std::system_error, std::generic_category
+
+// Records are read with POSIX 'read'. On other platforms this header is
+// empty, and BPSTD_HAS_RECORD_READER is 0.
+#if defined(__unix__) || defined(__APPLE__)
+# include <unistd.h> // ::read
+# define BPSTD_HAS_RECORD_READER 1
+#else
+# define BPSTD_HAS_RECORD_READER 0
+#endif
+
+#if BPSTD_HAS_RECORD_READER
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+  namespace detail {
+
+    /// \brief The number of bytes a record_reader buffers by default
+    constexpr std::size_t record_reader_default_capacity = 64u * 1024u;
+
+  } // namespace detail
+
+  //============================================================================
+  // class : record_reader
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Reads records separated by a delimiter from a file descriptor
+  ///
+  /// The descriptor is read in large blocks into a reusable buffer, and each
+  /// record is handed out as a \c string_view into that buffer, so no
+  /// allocations or copies are made per record. A record that is cut off by
+  /// the end of the buffer is moved to its front before the next read, and
+  /// the buffer only grows if a single record does not fit in it.
+  ///
+  /// The descriptor is not owned, and may be a file, pipe or socket.
+  ///
+  /// \code
+  /// auto reader = bpstd::record_reader{fd};
+  /// while (auto line = reader.next()) {
+  ///   process(*line);
+  /// }
+  /// \endcode
+  //////////////////////////////////////////////////////////////////////////////
+  class record_reader
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using size_type = std::size_t;
+
+    //--------------------------------------------------------------------------
+    // Constructors / Assignment
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a reader of the records in \p fd
+    ///
+    /// \param fd the file descriptor to read from
+    /// \param delimiter the character that separates records
+    /// \param capacity the initial size of the buffer, in bytes
+    explicit record_reader(int fd,
+                           char delimiter = '\n',
+                           size_type capacity = detail::record_reader_default_capacity);
+
+    record_reader(record_reader&& other) noexcept = default;
+    record_reader(const record_reader&) = delete;
+
+    //--------------------------------------------------------------------------
+
+    record_reader& operator=(record_reader&& other) noexcept = default;
+    record_reader& operator=(const record_reader&) = delete;
+
+    //--------------------------------------------------------------------------
+    // Reading
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Reads the next record, without its delimiter
+    ///
+    /// The final record does not need to be followed by a delimiter. The
+    /// returned view is only valid until the next call to next().
+    ///
+    /// \throw std::system_error if reading from the descriptor fails
+    /// \return the record, or nullopt if there are no more records
+    optional<string_view> next();
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the file descriptor being read
+    ///
+    /// \return the file descriptor
+    int fd() const noexcept;
+
+    /// \brief Gets the character that separates records
+    ///
+    /// \return the delimiter
+    char delimiter() const noexcept;
+
+    /// \brief Gets the current size of the buffer, in bytes
+    ///
+    /// \return the capacity
+    size_type capacity() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Reads more data into the buffer after the pending record
+    ///
+    /// \throw std::system_error if reading from the descriptor fails
+    void refill();
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    std::unique_ptr<char[]> m_buffer;
+    size_type m_capacity;
+    size_type m_begin;   // start of the pending record
+    size_type m_end;     // end of the data read so far
+    size_type m_scanned; // bytes of the pending record known to be delimiter-free
+    int m_fd;
+    char m_delimiter;
+    bool m_is_eof;
+  };
+
+} // namespace bpstd
+
+//==============================================================================
+// class : record_reader
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors / Assignment
+//------------------------------------------------------------------------------
+
+inline
+bpstd::record_reader::record_reader(int fd,
+                                    char delimiter,
+                                    size_type capacity)
+  : m_buffer{new char[capacity > 0u ? capacity : 1u]},
+    m_capacity{capacity > 0u ? capacity : 1u},
+    m_begin{0u},
+    m_end{0u},
+    m_scanned{0u},
+    m_fd{fd},
+    m_delimiter{delimiter},
+    m_is_eof{false}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Reading
+//------------------------------------------------------------------------------
+
+inline
+bpstd::optional<bpstd::string_view> bpstd::record_reader::next()
+{
+  while (true) {
+    const auto pending = string_view{m_buffer.get() + m_begin, m_end - m_begin};
+
+    // Only the newly read bytes need to be searched for the delimiter
+    const auto index = pending.find(m_delimiter, m_scanned);
+    if (index != string_view::npos) {
+      m_begin += index + 1u;
+      m_scanned = 0u;
+      return pending.substr(0u, index);
+    }
+    m_scanned = pending.size();
+
+    if (m_is_eof) {
+      if (pending.empty()) {
+        return nullopt;
+      }
+      m_begin = m_end;
+      m_scanned = 0u;
+      return pending;
+    }
+    refill();
+  }
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+inline BPSTD_INLINE_VISIBILITY
+int bpstd::record_reader::fd()
+  const noexcept
+{
+  return m_fd;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+char bpstd::record_reader::delimiter()
+  const noexcept
+{
+  return m_delimiter;
+}
+
+inline BPSTD_INLINE_VISIBILITY
+bpstd::record_reader::size_type bpstd::record_reader::capacity()
+  const noexcept
+{
+  return m_capacity;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+inline
+void bpstd::record_reader::refill()
+{
+  const auto pending = m_end - m_begin;
+
+  if (pending == m_capacity) {
+    // The pending record fills the whole buffer, so it must grow
+    auto buffer = std::unique_ptr<char[]>{new char[m_capacity * 2u]};
+    std::memcpy(buffer.get(), m_buffer.get() + m_begin, pending);
+    m_buffer = std::move(buffer);
+    m_capacity *= 2u;
+  } else if (m_begin != 0u) {
+    // The start of a record that crosses the end of the buffer is moved to
+    // the front, so that the rest of it can be read after it
+    std::memmove(m_buffer.get(), m_buffer.get() + m_begin, pending);
+  }
+  m_begin = 0u;
+  m_end = pending;
+
+  while (true) {
+    const auto result = ::read(m_fd, m_buffer.get() + m_end, m_capacity - m_end);
+    if (result > 0) {
+      m_end += static_cast<size_type>(result);
+      return;
+    }
+    if (result == 0) {
+      m_is_eof = true;
+      return;
+    }
+    if (errno != EINTR) {
+      throw std::system_error{
+        errno,
+        std::generic_category(),
+        "bpstd::record_reader: unable to read"
+      };
+    }
+  }
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_HAS_RECORD_READER */
+
+#endif /* BPSTD_RECORD_READER_HPP */
@@ -502,7 +502,7 @@ template <typename It,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, size_type count)
   noexcept
-  : m_storage{to_address(it), count}
+  : m_storage{bpstd::to_address(it), count}
 {
 
 }
@@ -514,7 +514,7 @@ template <typename It,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, size_type count)
   noexcept
-  : m_storage{to_address(it), count}
+  : m_storage{bpstd::to_address(it), count}
 {
 
 }
@@ -526,7 +526,7 @@ template <typename It, typename End,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, End end)
   noexcept
-  : m_storage{to_address(it), static_cast<size_type>(end - it)}
+  : m_storage{bpstd::to_address(it), static_cast<size_type>(end - it)}
 {
 
 }
@@ -538,7 +538,7 @@ template <typename It, typename End,
 inline BPSTD_INLINE_VISIBILITY constexpr
 bpstd::span<T,Extent>::span(It it, End end)
   noexcept
-  : m_storage{to_address(it), static_cast<size_type>(end - it)}
+  : m_storage{bpstd::to_address(it), static_cast<size_type>(end - it)}
 {
 
 }
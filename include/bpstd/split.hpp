@@ -0,0 +1,623 @@
+////////////////////////////////////////////////////////////////////////////////
+/// \file split.hpp
+///
+/// \brief This header provides a lazy range over the delimited fields of a
+///        basic_string_view
+////////////////////////////////////////////////////////////////////////////////
+
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+#ifndef BPSTD_SPLIT_HPP
+#define BPSTD_SPLIT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "detail/config.hpp"
+#include "string_view.hpp" // basic_string_view
+#include "type_traits.hpp" // type_identity
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <iterator> // std::forward_iterator_tag
+#include <string>   // std::char_traits
+
+BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
+
+namespace bpstd {
+
+  //============================================================================
+  // enum class : empty_fields
+  //============================================================================
+
+  /// \brief Whether a split produces the empty fields between adjacent
+  ///        delimiters
+  enum class empty_fields
+  {
+    keep, ///< Empty fields are produced
+    skip, ///< Runs of delimiters are treated as a single delimiter
+  };
+
+  //============================================================================
+  // class : basic_split_view
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A lazy range of the fields of a basic_string_view, separated by
+  ///        a delimiter
+  ///
+  /// Each field is found only as the range is iterated, and is a view into
+  /// the original string, so splitting never allocates. A single delimiter
+  /// is located with basic_string_view::find, and a set of delimiters with
+  /// basic_string_view::find_first_of.
+  ///
+  /// Both the viewed string and any set of delimiters must outlive this
+  /// range and its iterators.
+  ///
+  /// \code
+  /// for (auto field : bpstd::split(line, ',')) {
+  ///   process(field);
+  /// }
+  /// \endcode
+  ///
+  /// \tparam CharT the character type
+  /// \tparam Traits the character traits
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename CharT, typename Traits = std::char_traits<CharT>>
+  class basic_split_view
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using char_type   = CharT;
+    using traits_type = Traits;
+    using size_type   = std::size_t;
+    using view_type   = basic_string_view<CharT,Traits>;
+
+    class iterator;
+    using const_iterator = iterator;
+
+    //--------------------------------------------------------------------------
+    // Public Members
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief A maximum number of splits that is never reached
+    static constexpr size_type unlimited = size_type(-1);
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Constructs a range of the fields of \p view separated by
+    ///        \p delimiter
+    ///
+    /// \param view the string to split
+    /// \param delimiter the character that separates fields
+    /// \param empty whether empty fields are produced
+    /// \param max_splits the most times to split; the remainder of the
+    ///        string is produced as the last field
+    constexpr basic_split_view(view_type view,
+                               char_type delimiter,
+                               empty_fields empty = empty_fields::keep,
+                               size_type max_splits = unlimited) noexcept;
+
+    /// \brief Constructs a range of the fields of \p view separated by any
+    ///        of the characters in \p delimiters
+    ///
+    /// \param view the string to split
+    /// \param delimiters the characters that separate fields
+    /// \param empty whether empty fields are produced
+    /// \param max_splits the most times to split; the remainder of the
+    ///        string is produced as the last field
+    constexpr basic_split_view(view_type view,
+                               view_type delimiters,
+                               empty_fields empty = empty_fields::keep,
+                               size_type max_splits = unlimited) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets an iterator to the first field, finding it
+    ///
+    /// \return the iterator
+    BPSTD_CPP14_CONSTEXPR iterator begin() const noexcept;
+
+    /// \brief Gets an iterator past the last field
+    ///
+    /// \return the iterator
+    BPSTD_CPP14_CONSTEXPR iterator end() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Gets the string being split
+    ///
+    /// \return the string
+    constexpr view_type source() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Finds the next delimiter at or after \p pos
+    BPSTD_CPP14_CONSTEXPR size_type find_delimiter(size_type pos) const noexcept;
+
+    /// \brief Finds the next character at or after \p pos that is not a
+    ///        delimiter
+    BPSTD_CPP14_CONSTEXPR size_type skip_delimiters(size_type pos) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    view_type    m_view;
+    view_type    m_delimiters; ///< The set of delimiters, if m_is_any_of
+    size_type    m_max_splits;
+    char_type    m_delimiter;  ///< The delimiter, if not m_is_any_of
+    bool         m_is_any_of;
+    empty_fields m_empty;
+  };
+
+  template <typename CharT, typename Traits>
+  constexpr typename basic_split_view<CharT,Traits>::size_type
+    basic_split_view<CharT,Traits>::unlimited;
+
+  //============================================================================
+  // class : basic_split_view::iterator
+  //============================================================================
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A forward iterator over the fields of a basic_split_view
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename CharT, typename Traits>
+  class basic_split_view<CharT,Traits>::iterator
+  {
+    //--------------------------------------------------------------------------
+    // Public Member Types
+    //--------------------------------------------------------------------------
+  public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = view_type;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = const view_type*;
+    using reference         = const view_type&;
+
+    //--------------------------------------------------------------------------
+    // Constructors
+    //--------------------------------------------------------------------------
+  public:
+
+    /// \brief Default constructs an iterator that is past the end of every
+    ///        range
+    constexpr iterator() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Iteration
+    //--------------------------------------------------------------------------
+  public:
+
+    BPSTD_CPP14_CONSTEXPR iterator& operator++() noexcept;
+    BPSTD_CPP14_CONSTEXPR iterator operator++(int) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Observers
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr reference operator*() const noexcept;
+    constexpr pointer operator->() const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Comparison
+    //--------------------------------------------------------------------------
+  public:
+
+    constexpr bool operator==(const iterator& rhs) const noexcept;
+    constexpr bool operator!=(const iterator& rhs) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Constructors
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Constructs an iterator to the first field of \p parent
+    BPSTD_CPP14_CONSTEXPR explicit iterator(const basic_split_view* parent) noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Member Functions
+    //--------------------------------------------------------------------------
+  private:
+
+    /// \brief Finds the field that starts the search at m_next
+    BPSTD_CPP14_CONSTEXPR void advance() noexcept;
+
+    //--------------------------------------------------------------------------
+    // Private Members
+    //--------------------------------------------------------------------------
+  private:
+
+    const basic_split_view* m_parent; ///< The range, or null at the end
+    view_type m_field;
+    size_type m_next;       ///< Where to start searching for the next field
+    size_type m_splits;     ///< The number of splits that remain
+    bool      m_has_next;   ///< Whether the string continues after m_field
+
+    friend basic_split_view;
+  };
+
+  //----------------------------------------------------------------------------
+  // Type Aliases
+  //----------------------------------------------------------------------------
+
+  using split_view    = basic_split_view<char>;
+  using wsplit_view   = basic_split_view<wchar_t>;
+  using u16split_view = basic_split_view<char16_t>;
+  using u32split_view = basic_split_view<char32_t>;
+
+  //----------------------------------------------------------------------------
+  // Utilities
+  //----------------------------------------------------------------------------
+
+  /// \brief Lazily splits \p view into the fields separated by \p delimiter
+  ///
+  /// \code
+  /// const auto csv = bpstd::string_view{"a,,b,c"};
+  ///
+  /// bpstd::split(csv, ',');                                 // "a", "", "b", "c"
+  /// bpstd::split(csv, ',', bpstd::empty_fields::skip);      // "a", "b", "c"
+  /// bpstd::split(csv, ',', bpstd::empty_fields::keep, 2u);  // "a", "", "b,c"
+  /// \endcode
+  ///
+  /// \param view the string to split
+  /// \param delimiter the character that separates fields
+  /// \param empty whether empty fields are produced
+  /// \param max_splits the most times to split; the remainder of the string
+  ///        is produced as the last field
+  /// \return a range of the fields
+  template <typename CharT, typename Traits>
+  constexpr basic_split_view<CharT,Traits>
+    split(basic_string_view<CharT,Traits> view,
+          typename type_identity<CharT>::type delimiter,
+          empty_fields empty = empty_fields::keep,
+          std::size_t max_splits = basic_split_view<CharT,Traits>::unlimited) noexcept;
+
+  /// \brief Lazily splits \p view into the fields separated by any of the
+  ///        characters in \p delimiters
+  ///
+  /// \code
+  /// const auto header = bpstd::string_view{"Accept: text/html"};
+  ///
+  /// bpstd::split(header, ": ", bpstd::empty_fields::skip); // "Accept", "text/html"
+  /// \endcode
+  ///
+  /// \param view the string to split
+  /// \param delimiters the characters that separate fields
+  /// \param empty whether empty fields are produced
+  /// \param max_splits the most times to split; the remainder of the string
+  ///        is produced as the last field
+  /// \return a range of the fields
+  template <typename CharT, typename Traits>
+  constexpr basic_split_view<CharT,Traits>
+    split(basic_string_view<CharT,Traits> view,
+          typename type_identity<basic_string_view<CharT,Traits>>::type delimiters,
+          empty_fields empty = empty_fields::keep,
+          std::size_t max_splits = basic_split_view<CharT,Traits>::unlimited) noexcept;
+
+} // namespace bpstd
+
+//==============================================================================
+// class : basic_split_view
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits>::basic_split_view(view_type view,
+                                                        char_type delimiter,
+                                                        empty_fields empty,
+                                                        size_type max_splits)
+  noexcept
+  : m_view{view},
+    m_delimiters{},
+    m_max_splits{max_splits},
+    m_delimiter{delimiter},
+    m_is_any_of{false},
+    m_empty{empty}
+{
+
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits>::basic_split_view(view_type view,
+                                                        view_type delimiters,
+                                                        empty_fields empty,
+                                                        size_type max_splits)
+  noexcept
+  : m_view{view},
+    m_delimiters{delimiters},
+    m_max_splits{max_splits},
+    m_delimiter{},
+    m_is_any_of{true},
+    m_empty{empty}
+{
+
+}
+
+//------------------------------------------------------------------------------
+// Iterators
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits>::iterator
+  bpstd::basic_split_view<CharT,Traits>::begin()
+  const noexcept
+{
+  return iterator{this};
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits>::iterator
+  bpstd::basic_split_view<CharT,Traits>::end()
+  const noexcept
+{
+  return iterator{};
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::basic_split_view<CharT,Traits>::view_type
+  bpstd::basic_split_view<CharT,Traits>::source()
+  const noexcept
+{
+  return m_view;
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits>::size_type
+  bpstd::basic_split_view<CharT,Traits>::find_delimiter(size_type pos)
+  const noexcept
+{
+  return m_is_any_of
+    ? m_view.find_first_of(m_delimiters, pos)
+    : m_view.find(m_delimiter, pos);
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits>::size_type
+  bpstd::basic_split_view<CharT,Traits>::skip_delimiters(size_type pos)
+  const noexcept
+{
+  return m_is_any_of
+    ? m_view.find_first_not_of(m_delimiters, pos)
+    : m_view.find_first_not_of(m_delimiter, pos);
+}
+
+//==============================================================================
+// class : basic_split_view::iterator
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Constructors
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits>::iterator::iterator()
+  noexcept
+  : m_parent{nullptr},
+    m_field{},
+    m_next{0u},
+    m_splits{0u},
+    m_has_next{false}
+{
+
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+bpstd::basic_split_view<CharT,Traits>::iterator::iterator(const basic_split_view* parent)
+  noexcept
+  : m_parent{parent},
+    m_field{},
+    m_next{0u},
+    m_splits{parent->m_max_splits},
+    m_has_next{true}
+{
+  advance();
+}
+
+//------------------------------------------------------------------------------
+// Iteration
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits>::iterator&
+  bpstd::basic_split_view<CharT,Traits>::iterator::operator++()
+  noexcept
+{
+  advance();
+  return (*this);
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+typename bpstd::basic_split_view<CharT,Traits>::iterator
+  bpstd::basic_split_view<CharT,Traits>::iterator::operator++(int)
+  noexcept
+{
+  auto copy = (*this);
+  advance();
+  return copy;
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::basic_split_view<CharT,Traits>::iterator::reference
+  bpstd::basic_split_view<CharT,Traits>::iterator::operator*()
+  const noexcept
+{
+  return m_field;
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+typename bpstd::basic_split_view<CharT,Traits>::iterator::pointer
+  bpstd::basic_split_view<CharT,Traits>::iterator::operator->()
+  const noexcept
+{
+  return &m_field;
+}
+
+//------------------------------------------------------------------------------
+// Comparison
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::basic_split_view<CharT,Traits>::iterator::operator==(const iterator& rhs)
+  const noexcept
+{
+  // Every field of a range starts at a different character, so comparing
+  // where the fields start is enough to tell them apart
+  return m_parent == rhs.m_parent &&
+         m_field.data() == rhs.m_field.data() &&
+         m_field.size() == rhs.m_field.size();
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bool bpstd::basic_split_view<CharT,Traits>::iterator::operator!=(const iterator& rhs)
+  const noexcept
+{
+  return !((*this) == rhs);
+}
+
+//------------------------------------------------------------------------------
+// Private Member Functions
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_CPP14_CONSTEXPR
+void bpstd::basic_split_view<CharT,Traits>::iterator::advance()
+  noexcept
+{
+  if (!m_has_next) {
+    (*this) = iterator{};
+    return;
+  }
+
+  const auto source = m_parent->m_view;
+  auto pos = m_next;
+
+  if (m_parent->m_empty == empty_fields::skip) {
+    // Skipping the delimiters up front also keeps them out of the remainder
+    // that is produced once the splits run out
+    pos = m_parent->skip_delimiters(pos);
+    if (pos == view_type::npos) {
+      (*this) = iterator{};
+      return;
+    }
+  }
+
+  const auto index = (m_splits == 0u)
+    ? view_type::npos
+    : m_parent->find_delimiter(pos);
+
+  if (index == view_type::npos) {
+    m_field = view_type{source.data() + pos, source.size() - pos};
+    m_has_next = false;
+    return;
+  }
+  m_field = view_type{source.data() + pos, index - pos};
+  m_next = index + 1u;
+  --m_splits;
+}
+
+//==============================================================================
+// non-member functions
+//==============================================================================
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits>
+  bpstd::split(basic_string_view<CharT,Traits> view,
+               typename type_identity<CharT>::type delimiter,
+               empty_fields empty,
+               std::size_t max_splits)
+  noexcept
+{
+  return basic_split_view<CharT,Traits>{view, delimiter, empty, max_splits};
+}
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY constexpr
+bpstd::basic_split_view<CharT,Traits>
+  bpstd::split(basic_string_view<CharT,Traits> view,
+               typename type_identity<basic_string_view<CharT,Traits>>::type delimiters,
+               empty_fields empty,
+               std::size_t max_splits)
+  noexcept
+{
+  return basic_split_view<CharT,Traits>{view, delimiters, empty, max_splits};
+}
+
+BPSTD_COMPILER_DIAGNOSTIC_POSTAMBLE
+
+#endif /* BPSTD_SPLIT_HPP */
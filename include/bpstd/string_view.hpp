@@ -34,7 +34,10 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
-#include "detail/config.hpp" // BPSTD_CPP14_CONSTEXPR
+#include "detail/config.hpp"          // BPSTD_CPP14_CONSTEXPR
+#include "detail/string_search.hpp"   // detail::search_forward, etc
+#include "detail/char_set_search.hpp" // detail::set_search_forward, etc
+#include "detail/string_hash.hpp"     // detail::hash_chars
 
 #include <algorithm>  // std::min, std::max
 #include <string>     // std::char_traits
@@ -44,6 +47,14 @@
 #include <stdexcept>  // std::out_of_range
 #include <iterator>   // std::reverse_iterator
 #include <ios>        // std::streamsize
+#include <functional> // std::hash
+
+// BPSTD_STRING_VIEW_USE_STD_HASH makes std::hash<basic_string_view> produce the
+// same values as std::hash<std::basic_string>. This requires a copy into a
+// std::basic_string prior to C++17, so by default a faster hash is used.
+#if !defined(BPSTD_STRING_VIEW_USE_STD_HASH)
+# define BPSTD_STRING_VIEW_USE_STD_HASH 0
+#endif
 
 BPSTD_COMPILER_DIAGNOSTIC_PREAMBLE
 
@@ -442,13 +453,6 @@ namespace bpstd { // back-port std
 
     const char_type* m_str;  ///< The internal string type
     size_type        m_size; ///< The size of this string
-
-    /// \brief Checks whether \p c is one of the characters in \p str
-    ///
-    /// \param c the character to check
-    /// \param str the characters to compare against
-    /// \return true if \p c is one of the characters in \p str
-    static BPSTD_CPP14_CONSTEXPR bool is_one_of(CharT c, basic_string_view str);
   };
 
   template <typename CharT, typename Traits>
@@ -510,8 +514,49 @@ namespace bpstd { // back-port std
   using u16string_view = basic_string_view<char16_t>;
   using u32string_view = basic_string_view<char32_t>;
 
+  //----------------------------------------------------------------------------
+  // Hashing
+  //----------------------------------------------------------------------------
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief A fast non-cryptographic hash function for basic_string_view
+  ///
+  /// Views are hashed with a 64-bit 'wyhash' over the characters, which is
+  /// usable in 'constexpr' contexts from C++14 onwards. The result is *not*
+  /// the same as std::hash<std::basic_string>.
+  ///
+  /// This is the hash used by std::hash<basic_string_view>, unless
+  /// BPSTD_STRING_VIEW_USE_STD_HASH is defined to 1.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename CharT, typename Traits = std::char_traits<CharT>>
+  struct basic_string_view_hash
+  {
+    /// \brief Hashes the characters of \p v
+    ///
+    /// \param v the view to hash
+    /// \return the hash of \p v
+    BPSTD_CPP14_CONSTEXPR std::size_t
+      operator()(basic_string_view<CharT,Traits> v) const noexcept;
+  };
+
 } // namespace bpstd
 
+namespace std {
+
+  template <typename CharT>
+  struct hash<::bpstd::basic_string_view<CharT,std::char_traits<CharT>>>
+#if BPSTD_STRING_VIEW_USE_STD_HASH
+  {
+    std::size_t operator()(::bpstd::basic_string_view<CharT> v) const;
+  };
+#else
+    : ::bpstd::basic_string_view_hash<CharT>
+  {
+  };
+#endif
+
+} // namespace std
+
 //==============================================================================
 // definition : class : basic_string_view
 //==============================================================================
@@ -832,20 +877,10 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
   if (pos > size()) {
     return npos;
   }
-  if ((pos + v.size()) > size()) {
-    return npos;
-  }
-
-  const auto offset = pos;
-  const auto increments = size() - v.size();
 
-  for (auto i = 0u; i <= increments; ++i) {
-    const auto j = i + offset;
-    if (substr(j, v.size()) == v) {
-      return j;
-    }
-  }
-  return npos;
+  const auto result = detail::search_forward<Traits>(m_str + pos, m_size - pos,
+                                                     v.m_str, v.m_size);
+  return (result == detail::search_npos) ? npos : (result + pos);
 }
 
 template <typename CharT, typename Traits>
@@ -897,15 +932,12 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
     return npos;
   }
 
-  auto i = std::min(pos, (size() - v.size()));
-  while (i != npos) {
-    if (substr(i, v.size()) == v) {
-      return i;
-    }
-    --i;
-  }
-
-  return npos;
+  // Only matches starting at or before 'pos' are considered, so the searched
+  // range ends 'v.size()' characters after the last candidate
+  const auto last = std::min(pos, (size() - v.size()));
+  const auto result = detail::search_reverse<Traits>(m_str, last + v.size(),
+                                                     v.m_str, v.m_size);
+  return (result == detail::search_npos) ? npos : result;
 }
 
 template <typename CharT, typename Traits>
@@ -948,14 +980,13 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
                                                         size_type pos)
   const
 {
-  const auto max_index = size();
-  for (auto i = pos; i < max_index;  ++i) {
-    if (is_one_of(m_str[i],v)) {
-      return i;
-    }
+  if (pos >= size()) {
+    return npos;
   }
 
-  return npos;
+  const auto result = detail::set_search_forward<Traits>(m_str + pos, m_size - pos,
+                                                         v.m_str, v.m_size, true);
+  return (result == detail::search_npos) ? npos : (result + pos);
 }
 
 template <typename CharT, typename Traits>
@@ -1002,15 +1033,9 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
     return npos;
   }
   const auto max_index = std::min(size() - 1, pos);
-  for (auto i = 0u; i <= max_index;  ++i) {
-    const auto j = max_index - i;
-
-    if (is_one_of(m_str[j],v)) {
-      return j;
-    }
-  }
-
-  return npos;
+  const auto result = detail::set_search_reverse<Traits>(m_str, max_index + 1,
+                                                         v.m_str, v.m_size, true);
+  return (result == detail::search_npos) ? npos : result;
 }
 
 template <typename CharT, typename Traits>
@@ -1053,14 +1078,13 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
                                                             size_type pos)
   const
 {
-  const auto max_index = size();
-  for (auto i = pos; i < max_index;  ++i) {
-    if (!is_one_of(m_str[i],v)) {
-      return i;
-    }
+  if (pos >= size()) {
+    return npos;
   }
 
-  return npos;
+  const auto result = detail::set_search_forward<Traits>(m_str + pos, m_size - pos,
+                                                         v.m_str, v.m_size, false);
+  return (result == detail::search_npos) ? npos : (result + pos);
 }
 
 template <typename CharT, typename Traits>
@@ -1107,15 +1131,9 @@ typename bpstd::basic_string_view<CharT,Traits>::size_type
     return npos;
   }
   const auto max_index = std::min(size() - 1, pos);
-  for (auto i = 0u; i <= max_index;  ++i) {
-    const auto j = max_index - i;
-
-    if (!is_one_of(m_str[j],v)) {
-      return j;
-    }
-  }
-
-  return npos;
+  const auto result = detail::set_search_reverse<Traits>(m_str, max_index + 1,
+                                                         v.m_str, v.m_size, false);
+  return (result == detail::search_npos) ? npos : result;
 }
 
 template <typename CharT, typename Traits>
@@ -1225,19 +1243,6 @@ typename bpstd::basic_string_view<CharT,Traits>::const_reverse_iterator
   return crend();
 }
 
-template <typename CharT, typename Traits>
-inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
-bool bpstd::basic_string_view<CharT,Traits>::is_one_of(CharT c,
-                                                       basic_string_view str)
-{
-  for (auto s : str) {
-    if (Traits::eq(c,s)) {
-      return true;
-    }
-  }
-  return false;
-}
-
 //------------------------------------------------------------------------------
 // Public Functions
 //------------------------------------------------------------------------------
@@ -1261,6 +1266,40 @@ void bpstd::swap(basic_string_view<CharT,Traits>& lhs,
   lhs.swap(rhs);
 }
 
+//==============================================================================
+// definition : class : basic_string_view_hash
+//==============================================================================
+
+template <typename CharT, typename Traits>
+inline BPSTD_INLINE_VISIBILITY BPSTD_CPP14_CONSTEXPR
+std::size_t bpstd::basic_string_view_hash<CharT,Traits>
+  ::operator()(basic_string_view<CharT,Traits> v)
+  const noexcept
+{
+  return static_cast<std::size_t>(detail::hash_chars(v.data(), v.size()));
+}
+
+#if BPSTD_STRING_VIEW_USE_STD_HASH
+
+template <typename CharT>
+inline BPSTD_INLINE_VISIBILITY
+std::size_t std::hash<::bpstd::basic_string_view<CharT,std::char_traits<CharT>>>
+  ::operator()(::bpstd::basic_string_view<CharT> v)
+  const
+{
+#if defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+  using view_type = std::basic_string_view<CharT>;
+
+  return std::hash<view_type>{}(view_type(v.data(), v.size()));
+#else
+  using string_type = std::basic_string<CharT>;
+
+  return std::hash<string_type>{}(string_type(v.data(), v.size()));
+#endif
+}
+
+#endif // BPSTD_STRING_VIEW_USE_STD_HASH
+
 //------------------------------------------------------------------------------
 // Comparison Functions
 //------------------------------------------------------------------------------
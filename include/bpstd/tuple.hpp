@@ -123,9 +123,11 @@ namespace bpstd {
     template <typename Fn, typename Seq, typename Tuple>
     struct apply_result_impl;
 
+    // The elements are passed with the value category of 'Tuple', as they
+    // are by 'std::get', which also allows 'Tuple' to be an lvalue reference
     template <typename Fn, std::size_t...Idx, typename Tuple>
     struct apply_result_impl<Fn, index_sequence<Idx...>, Tuple>
-      : invoke_result<Fn, tuple_element_t<Idx, Tuple>...>{};
+      : invoke_result<Fn, decltype(std::get<Idx>(std::declval<Tuple>()))...>{};
 
     template <typename Fn, typename Tuple>
     struct apply_result : apply_result_impl<
@@ -169,8 +169,13 @@ namespace bpstd {
 
   namespace detail {
 
+    // Any result may be discarded by a call to a 'void' function
     template <bool IsInvocable, typename R, typename Fn, typename...Args>
-    struct is_invocable_return : std::is_convertible<invoke_result_t<Fn,Args...>, R>{};
+    struct is_invocable_return
+      : std::integral_constant<bool,
+          std::is_void<R>::value ||
+          std::is_convertible<invoke_result_t<Fn,Args...>, R>::value
+        >{};
 
     template <typename R, typename Fn, typename...Args>
     struct is_invocable_return<false, R, Fn, Args...> : false_type{};
@@ -196,19 +196,74 @@ namespace bpstd {
   using index_sequence = integer_sequence<std::size_t, Ints...>;
 
   namespace detail {
-    template <typename T, bool End, T N, T...Tails>
+
+    // The portable construction doubles a sequence of N/2 indices, appending
+    // one more index when N is odd, so building a sequence of N elements is
+    // only O(log N) instantiations deep
+
+    template <typename Seq, bool Odd>
+    struct double_index_sequence;
+
+    template <std::size_t...Idxs>
+    struct double_index_sequence<index_sequence<Idxs...>, false>
+      : type_identity<index_sequence<Idxs..., (sizeof...(Idxs) + Idxs)...>>{};
+
+    template <std::size_t...Idxs>
+    struct double_index_sequence<index_sequence<Idxs...>, true>
+      : type_identity<index_sequence<
+          Idxs..., (sizeof...(Idxs) + Idxs)..., (2u * sizeof...(Idxs))
+        >>{};
+
+    template <std::size_t N>
+    struct make_index_sequence_impl
+      : double_index_sequence<
+          typename make_index_sequence_impl<N / 2u>::type,
+          (N % 2u) != 0u
+        >{};
+
+    template <>
+    struct make_index_sequence_impl<0u> : type_identity<index_sequence<>>{};
+
+    template <>
+    struct make_index_sequence_impl<1u> : type_identity<index_sequence<0u>>{};
+
+    template <typename T, typename Seq>
+    struct convert_index_sequence;
+
+    template <typename T, std::size_t...Idxs>
+    struct convert_index_sequence<T, index_sequence<Idxs...>>
+      : type_identity<integer_sequence<T, static_cast<T>(Idxs)...>>{};
+
+    // Negative sizes are diagnosed before any sequence is built, since
+    // converting them to std::size_t would request an enormous sequence
+    template <typename T, T N, bool IsValid = (N == T(0) || T(0) < N)>
     struct make_integer_sequence_impl
-      : make_integer_sequence_impl<T,((N-1) == T(0)), N-1, N-1, Tails...>{};
+    {
+      static_assert(IsValid, "make_integer_sequence requires a non-negative size");
+    };
 
-    template <typename T, T N, T...Tails>
-    struct make_integer_sequence_impl<T, true, N, Tails...>
-      : type_identity<integer_sequence<T, Tails...>>{};
+    template <typename T, T N>
+    struct make_integer_sequence_impl<T, N, true>
+      : convert_index_sequence<
+          T,
+          typename make_index_sequence_impl<static_cast<std::size_t>(N)>::type
+        >{};
 
   } // namespace detail
 
+  // Compilers that provide an intrinsic for building sequences do so in
+  // constant depth, regardless of N
+#if BPSTD_HAS_BUILTIN(__make_integer_seq) || (defined(_MSC_VER) && _MSC_VER >= 1910)
+  template <typename T, T N>
+  using make_integer_sequence = __make_integer_seq<integer_sequence, T, N>;
+#elif BPSTD_HAS_BUILTIN(__integer_pack)
+  template <typename T, T N>
+  using make_integer_sequence = integer_sequence<T, __integer_pack(N)...>;
+#else
   template <typename T, T N>
   using make_integer_sequence
-    = typename detail::make_integer_sequence_impl<T, (N==T(0)), N>::type;
+    = typename detail::make_integer_sequence_impl<T, N>::type;
+#endif
 
   template<std::size_t N>
   using make_index_sequence = make_integer_sequence<std::size_t, N>;
@@ -0,0 +1,158 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/aho_corasick.hpp>
+
+#include <stdexcept> // std::invalid_argument
+#include <string>    // std::string
+#include <utility>   // std::pair
+#include <vector>    // std::vector
+
+#include <catch2/catch.hpp>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  /// \brief A match, as (pattern, offset)
+  using match_pair = std::pair<std::size_t,std::size_t>;
+  using matches = std::vector<match_pair>;
+
+  /// \brief Collects every match of \p matcher in \p text
+  matches find_all(const bpstd::aho_corasick& matcher, bpstd::string_view text)
+  {
+    auto result = matches{};
+    matcher.find_all(text, [&](bpstd::aho_corasick::match m) {
+      result.emplace_back(m.pattern, m.offset);
+    });
+    return result;
+  }
+
+} // namespace <anonymous>
+
+//----------------------------------------------------------------------------
+// Constructors
+//----------------------------------------------------------------------------
+
+TEST_CASE("aho_corasick::aho_corasick( ForwardIt, ForwardIt )", "[aho_corasick]")
+{
+  SECTION("Patterns are strings")
+  {
+    const auto patterns = std::vector<std::string>{"abc", "bc", "abc"};
+    const auto sut = bpstd::aho_corasick{patterns.begin(), patterns.end()};
+
+    SECTION("Matches each pattern by its index")
+    {
+      REQUIRE( find_all(sut, bpstd::string_view{"xabc"}) == matches{{0u, 1u}, {2u, 1u}, {1u, 2u}} );
+    }
+    SECTION("Counts every pattern")
+    {
+      REQUIRE( sut.pattern_count() == 3u );
+    }
+  }
+  SECTION("A pattern is empty")
+  {
+    const auto patterns = std::vector<std::string>{"abc", ""};
+
+    SECTION("Throws std::invalid_argument")
+    {
+      REQUIRE_THROWS_AS( (bpstd::aho_corasick{patterns.begin(), patterns.end()}), std::invalid_argument );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Matching
+//----------------------------------------------------------------------------
+
+TEST_CASE("aho_corasick::find_all( string_view, Fn&& )", "[aho_corasick]")
+{
+  const auto sut = bpstd::aho_corasick{"he", "she", "his", "hers"};
+
+  SECTION("Patterns overlap in the text")
+  {
+    SECTION("Reports every match, longest first at the same end")
+    {
+      REQUIRE( find_all(sut, bpstd::string_view{"ushers"}) == matches{{1u, 1u}, {0u, 2u}, {3u, 2u}} );
+    }
+  }
+  SECTION("Text contains no patterns")
+  {
+    SECTION("Reports nothing")
+    {
+      REQUIRE( find_all(sut, bpstd::string_view{"abcdefg"}).empty() );
+    }
+  }
+  SECTION("Text contains bytes that are in no pattern")
+  {
+    const auto text = bpstd::string_view{"h\0\xffhis", 6u};
+
+    SECTION("Restarts the match")
+    {
+      REQUIRE( find_all(sut, text) == matches{{2u, 3u}} );
+    }
+  }
+}
+
+TEST_CASE("aho_corasick::scanner::feed( string_view, Fn&& )", "[aho_corasick]")
+{
+  const auto matcher = bpstd::aho_corasick{"needle", "dl"};
+  auto sut = bpstd::aho_corasick::scanner{matcher};
+  auto result = matches{};
+  const auto collect = [&](bpstd::aho_corasick::match m) {
+    result.emplace_back(m.pattern, m.offset);
+  };
+
+  SECTION("A match spans chunks")
+  {
+    sut.feed(bpstd::string_view{"hayne"}, collect);
+    sut.feed(bpstd::string_view{"ed"}, collect);
+    sut.feed(bpstd::string_view{"le"}, collect);
+
+    SECTION("Reports it in the chunk with its last byte")
+    {
+      REQUIRE( result == matches{{1u, 6u}, {0u, 3u}} );
+    }
+    SECTION("Counts the bytes fed")
+    {
+      REQUIRE( sut.offset() == 9u );
+    }
+  }
+  SECTION("Scanner is reset between chunks")
+  {
+    sut.feed(bpstd::string_view{"nee"}, collect);
+    sut.reset();
+    sut.feed(bpstd::string_view{"dle"}, collect);
+
+    SECTION("Does not match across the reset")
+    {
+      REQUIRE( result == matches{{1u, 0u}} );
+    }
+  }
+}
@@ -26,7 +26,10 @@
 
 #include <string>
 #include <utility>
+#include <memory>    // std::unique_ptr
 #include <typeindex>
+#include <cstddef>   // std::size_t
+#include <new>       // operator new
 
 #include <catch2/catch.hpp>
 
@@ -56,6 +59,70 @@ namespace {
     char buffer[sizeof(bpstd::any)];
   };
 
+  // An over-aligned object that counts the number of times it is allocated
+  struct alignas(16) counted_object
+  {
+    static int allocations;
+
+    static void* operator new(std::size_t size)
+    {
+      ++allocations;
+      return ::operator new(size);
+    }
+    static void operator delete(void* p) noexcept
+    {
+      ::operator delete(p);
+    }
+
+    char buffer[48];
+  };
+
+  int counted_object::allocations = 0;
+
+  struct allocation_counts
+  {
+    int allocations;
+    int deallocations;
+  };
+
+  // An allocator that records the number of allocations and deallocations
+  template <typename T>
+  struct counting_allocator
+  {
+    using value_type = T;
+
+    explicit counting_allocator(allocation_counts* counts) : counts{counts}{}
+
+    template <typename U>
+    counting_allocator(const counting_allocator<U>& other) : counts{other.counts}{}
+
+    T* allocate(std::size_t n)
+    {
+      ++counts->allocations;
+      return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n)
+    {
+      ++counts->deallocations;
+      std::allocator<T>{}.deallocate(p, n);
+    }
+
+    allocation_counts* counts;
+  };
+
+  template <typename T, typename U>
+  bool operator==(const counting_allocator<T>& lhs, const counting_allocator<U>& rhs)
+  {
+    return lhs.counts == rhs.counts;
+  }
+
+  template <typename T, typename U>
+  bool operator!=(const counting_allocator<T>& lhs, const counting_allocator<U>& rhs)
+  {
+    return lhs.counts != rhs.counts;
+  }
+
 } // anonymous namespace
 
 //=============================================================================
@@ -711,6 +778,17 @@ TEST_CASE("any_cast(any_cast*)", "[utilities]")
       }
     }
 
+    SECTION("Cast to const-qualified type")
+    {
+      const auto* result = bpstd::any_cast<const int>(&sut);
+
+      SECTION("Gets stored value")
+      {
+        REQUIRE(result != nullptr);
+        REQUIRE(*result == value);
+      }
+    }
+
     SECTION("Cast to incorrect type")
     {
       const auto* result = bpstd::any_cast<long>(&sut);
@@ -720,6 +798,16 @@ TEST_CASE("any_cast(any_cast*)", "[utilities]")
         REQUIRE(result == nullptr);
       }
     }
+
+    SECTION("Cast to non-copyable type")
+    {
+      const auto* result = bpstd::any_cast<std::unique_ptr<int>>(&sut);
+
+      SECTION("Result is null")
+      {
+        REQUIRE(result == nullptr);
+      }
+    }
   }
 }
 
@@ -766,3 +854,314 @@ TEST_CASE("any_cast(const any_cast*)", "[utilities]")
     }
   }
 }
+
+//=============================================================================
+// class : basic_any
+//=============================================================================
+
+static_assert(
+  std::is_same<bpstd::any,bpstd::basic_any<4u * sizeof(void*), alignof(void*)>>::value,
+  "any must be a basic_any with a buffer of 4 pointers"
+);
+
+TEST_CASE("basic_any::basic_any( ValueType&& )","[ctor]")
+{
+  counted_object::allocations = 0;
+
+  SECTION("Value fits within the internal buffer")
+  {
+    using sut_type = bpstd::basic_any<64u, 16u>;
+
+    const auto sut = sut_type{counted_object{}};
+
+    SECTION("Contains a value")
+    {
+      REQUIRE( sut.has_value() );
+    }
+    SECTION("Value is stored without allocating")
+    {
+      REQUIRE( counted_object::allocations == 0 );
+    }
+    SECTION("Value is accessible with any_cast")
+    {
+      REQUIRE( bpstd::any_cast<counted_object>(&sut) != nullptr );
+    }
+    SECTION("Copy is stored without allocating")
+    {
+      const auto copy = sut;
+
+      REQUIRE( counted_object::allocations == 0 );
+    }
+  }
+
+  SECTION("Value exceeds the internal buffer")
+  {
+    const auto sut = bpstd::any{counted_object{}};
+
+    SECTION("Contains a value")
+    {
+      REQUIRE( sut.has_value() );
+    }
+    SECTION("Value is allocated")
+    {
+      REQUIRE( counted_object::allocations == 1 );
+    }
+    SECTION("Value is accessible with any_cast")
+    {
+      REQUIRE( bpstd::any_cast<counted_object>(&sut) != nullptr );
+    }
+  }
+
+  SECTION("Externally stored value is moved")
+  {
+    auto original = bpstd::any{counted_object{}};
+    const auto moved = std::move(original);
+
+    SECTION("Moved result contains the value")
+    {
+      REQUIRE( bpstd::any_cast<counted_object>(&moved) != nullptr );
+    }
+    SECTION("Original no longer contains a value")
+    {
+      REQUIRE_FALSE( original.has_value() );
+    }
+    SECTION("Allocation is transferred instead of repeated")
+    {
+      REQUIRE( counted_object::allocations == 1 );
+    }
+  }
+}
+
+TEST_CASE("basic_any::basic_any( std::allocator_arg_t, const Allocator&, ValueType&& )","[ctor]")
+{
+  auto counts = allocation_counts{0, 0};
+  const auto allocator = counting_allocator<char>{&counts};
+
+  SECTION("Value exceeds the internal buffer")
+  {
+    const auto value = large_object{::string_value};
+
+    {
+      const auto sut = bpstd::any{std::allocator_arg, allocator, value};
+
+      SECTION("Contains a value")
+      {
+        REQUIRE( sut.has_value() );
+      }
+      SECTION("Type is the same as the input")
+      {
+        REQUIRE( sut.type() == typeid(large_object) );
+      }
+      SECTION("Value is same as original input")
+      {
+        REQUIRE( bpstd::any_cast<const large_object&>(sut).value == value.value );
+      }
+      SECTION("Value is allocated with the allocator")
+      {
+        REQUIRE( counts.allocations == 1 );
+      }
+      SECTION("Copy is allocated with the allocator")
+      {
+        const auto copy = sut;
+
+        REQUIRE( counts.allocations == 2 );
+        REQUIRE( bpstd::any_cast<const large_object&>(copy).value == value.value );
+      }
+    }
+
+    SECTION("Value is deallocated with the allocator")
+    {
+      REQUIRE( counts.deallocations == counts.allocations );
+    }
+  }
+
+  SECTION("Value is moved")
+  {
+    auto original = bpstd::any{std::allocator_arg, allocator, large_object{::string_value}};
+    const auto moved = std::move(original);
+
+    SECTION("Moved result contains the value")
+    {
+      REQUIRE( bpstd::any_cast<const large_object&>(moved).value == ::string_value );
+    }
+    SECTION("Original no longer contains a value")
+    {
+      REQUIRE_FALSE( original.has_value() );
+    }
+    SECTION("Allocation is transferred instead of repeated")
+    {
+      REQUIRE( counts.allocations == 1 );
+      REQUIRE( counts.deallocations == 0 );
+    }
+  }
+
+  SECTION("Value fits within the internal buffer")
+  {
+    const auto sut = bpstd::any{std::allocator_arg, allocator, 42};
+
+    SECTION("Value is same as original input")
+    {
+      REQUIRE( bpstd::any_cast<int>(sut) == 42 );
+    }
+    SECTION("Allocator is not used")
+    {
+      REQUIRE( counts.allocations == 0 );
+    }
+  }
+}
+
+TEST_CASE("basic_any::basic_any( std::allocator_arg_t, const Allocator&, in_place_type_t<ValueType>, Args&&... )","[ctor]")
+{
+  auto counts = allocation_counts{0, 0};
+  const auto allocator = counting_allocator<char>{&counts};
+
+  const auto sut = bpstd::any{
+    std::allocator_arg,
+    allocator,
+    bpstd::in_place_type_t<large_object>{},
+    std::string{::string_value}
+  };
+
+  SECTION("Constructs an any with by calling the underlying T constructor")
+  {
+    SECTION("Contains a value")
+    {
+      REQUIRE( sut.has_value() );
+    }
+    SECTION("Value is same as original input")
+    {
+      REQUIRE( bpstd::any_cast<const large_object&>(sut).value == ::string_value );
+    }
+    SECTION("Value is allocated with the allocator")
+    {
+      REQUIRE( counts.allocations == 1 );
+    }
+  }
+}
+
+//=============================================================================
+// class : unique_any
+//=============================================================================
+
+static_assert(
+  !std::is_copy_constructible<bpstd::unique_any>::value,
+  "unique_any must not be copy-constructible"
+);
+static_assert(
+  !std::is_copy_assignable<bpstd::unique_any>::value,
+  "unique_any must not be copy-assignable"
+);
+static_assert(
+  std::is_nothrow_move_constructible<bpstd::unique_any>::value,
+  "unique_any must be nothrow move-constructible"
+);
+
+namespace {
+
+  // A move-only object that is too large for unique_any's internal buffer
+  struct large_move_only_object
+  {
+    explicit large_move_only_object(int v) : value{new int{v}}, buffer{}{}
+
+    std::unique_ptr<int> value;
+    char buffer[sizeof(bpstd::unique_any)];
+  };
+
+} // anonymous namespace
+
+TEST_CASE("unique_any::unique_any( ValueType&& )","[ctor]")
+{
+  SECTION("Value fits within the internal buffer")
+  {
+    auto sut = bpstd::unique_any{std::unique_ptr<int>{new int{42}}};
+
+    SECTION("Contains a value")
+    {
+      REQUIRE( sut.has_value() );
+    }
+    SECTION("Type is the same as the input")
+    {
+      REQUIRE( sut.type() == typeid(std::unique_ptr<int>) );
+    }
+    SECTION("Value is same as original input")
+    {
+      REQUIRE( *bpstd::any_cast<std::unique_ptr<int>&>(sut) == 42 );
+    }
+  }
+
+  SECTION("Value exceeds the internal buffer")
+  {
+    auto sut = bpstd::unique_any{large_move_only_object{42}};
+
+    SECTION("Contains a value")
+    {
+      REQUIRE( sut.has_value() );
+    }
+    SECTION("Value is same as original input")
+    {
+      REQUIRE( *bpstd::any_cast<large_move_only_object&>(sut).value == 42 );
+    }
+  }
+}
+
+TEST_CASE("unique_any::unique_any( unique_any&& )","[ctor]")
+{
+  auto original = bpstd::unique_any{large_move_only_object{42}};
+
+  auto moved = std::move(original);
+
+  SECTION("Moved result contains a value")
+  {
+    REQUIRE( moved.has_value() );
+  }
+  SECTION("Value is moved from the original")
+  {
+    REQUIRE( *bpstd::any_cast<large_move_only_object&>(moved).value == 42 );
+  }
+}
+
+TEST_CASE("unique_any::operator=( unique_any&& )","[assignment]")
+{
+  auto source = bpstd::unique_any{std::unique_ptr<int>{new int{42}}};
+  auto destination = bpstd::unique_any{large_move_only_object{0}};
+
+  destination = std::move(source);
+
+  SECTION("Destination contains the source value")
+  {
+    REQUIRE( *bpstd::any_cast<std::unique_ptr<int>&>(destination) == 42 );
+  }
+}
+
+TEST_CASE("unique_any::emplace( Args&&... )","[modifiers]")
+{
+  auto sut = bpstd::unique_any{};
+
+  auto& result = sut.emplace<std::unique_ptr<int>>(new int{42});
+
+  SECTION("Returns reference to the stored value")
+  {
+    REQUIRE( &result == bpstd::any_cast<std::unique_ptr<int>>(&sut) );
+  }
+  SECTION("Value is constructed from the arguments")
+  {
+    REQUIRE( *result == 42 );
+  }
+}
+
+TEST_CASE("unique_any::swap( unique_any& )","[modifiers]")
+{
+  auto lhs = bpstd::unique_any{std::unique_ptr<int>{new int{42}}};
+  auto rhs = bpstd::unique_any{large_move_only_object{24}};
+
+  lhs.swap(rhs);
+
+  SECTION("Left contains right's old value")
+  {
+    REQUIRE( *bpstd::any_cast<large_move_only_object&>(lhs).value == 24 );
+  }
+  SECTION("Right contains left's old value")
+  {
+    REQUIRE( *bpstd::any_cast<std::unique_ptr<int>&>(rhs) == 42 );
+  }
+}
@@ -0,0 +1,425 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/charconv.hpp>
+
+#include <cmath>   // std::isnan, std::signbit
+#include <cstdint> // std::int8_t, std::uint64_t
+#include <limits>  // std::numeric_limits
+#include <string>  // std::string
+
+#include <catch2/catch.hpp>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  /// \brief Formats \p value with to_chars into a std::string
+  template <typename...Args>
+  std::string format(Args...args)
+  {
+    char buffer[512];
+    const auto result = bpstd::to_chars(buffer, buffer + sizeof(buffer), args...);
+    REQUIRE( result.ec == std::errc{} );
+    return std::string(buffer, result.ptr);
+  }
+
+} // namespace <anonymous>
+
+//----------------------------------------------------------------------------
+// Integers
+//----------------------------------------------------------------------------
+
+TEST_CASE("from_chars( const char*, const char*, Integer&, int )", "[parsing]")
+{
+  SECTION("Input is a decimal integer")
+  {
+    const auto input = bpstd::string_view{"1234567890123456789x"};
+    auto value = std::uint64_t{};
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Parses the value")
+    {
+      REQUIRE( value == 1234567890123456789u );
+    }
+    SECTION("Stops at the first non-digit")
+    {
+      REQUIRE( result.ptr == input.data() + 19 );
+      REQUIRE( result.ec == std::errc{} );
+    }
+  }
+  SECTION("Input is negative")
+  {
+    const auto input = bpstd::string_view{"-128"};
+    auto value = std::int8_t{};
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Parses the minimum value")
+    {
+      REQUIRE( result.ec == std::errc{} );
+      REQUIRE( value == -128 );
+    }
+  }
+  SECTION("Input is in another base")
+  {
+    const auto input = bpstd::string_view{"-7fFf"};
+    auto value = 0;
+
+    bpstd::from_chars(input, value, 16);
+
+    SECTION("Parses digits in either case")
+    {
+      REQUIRE( value == -0x7fff );
+    }
+  }
+  SECTION("Input is out of range")
+  {
+    const auto input = bpstd::string_view{"256;"};
+    auto value = std::uint8_t{42u};
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Consumes every digit")
+    {
+      REQUIRE( result.ptr == input.data() + 3 );
+    }
+    SECTION("Reports the error")
+    {
+      REQUIRE( result.ec == std::errc::result_out_of_range );
+    }
+    SECTION("Leaves the value unmodified")
+    {
+      REQUIRE( value == 42u );
+    }
+  }
+  SECTION("Input overflows 64 bits")
+  {
+    const auto input = bpstd::string_view{"18446744073709551616"};
+    auto value = std::uint64_t{42u};
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Reports the error")
+    {
+      REQUIRE( result.ec == std::errc::result_out_of_range );
+      REQUIRE( value == 42u );
+    }
+  }
+  SECTION("Input has no digits")
+  {
+    const auto input = bpstd::string_view{"+1"};
+    auto value = 42;
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Reports the error without consuming anything")
+    {
+      REQUIRE( result.ptr == input.data() );
+      REQUIRE( result.ec == std::errc::invalid_argument );
+      REQUIRE( value == 42 );
+    }
+  }
+  SECTION("Input is negative for an unsigned type")
+  {
+    const auto input = bpstd::string_view{"-1"};
+    auto value = 42u;
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Reports the error")
+    {
+      REQUIRE( result.ec == std::errc::invalid_argument );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( char*, char*, Integer, int )", "[formatting]")
+{
+  SECTION("Value is decimal")
+  {
+    SECTION("Writes the digits")
+    {
+      REQUIRE( format(0) == "0" );
+      REQUIRE( format(1234567890) == "1234567890" );
+      REQUIRE( format(std::numeric_limits<long long>::min()) == "-9223372036854775808" );
+    }
+  }
+  SECTION("Value is in another base")
+  {
+    SECTION("Writes lower-case digits")
+    {
+      REQUIRE( format(255, 16) == "ff" );
+      REQUIRE( format(-5, 2) == "-101" );
+      REQUIRE( format(35u, 36) == "z" );
+    }
+  }
+  SECTION("Buffer is too small")
+  {
+    char buffer[3];
+
+    const auto result = bpstd::to_chars(bpstd::span<char>{buffer}, 1234);
+
+    SECTION("Reports the error")
+    {
+      REQUIRE( result.ptr == buffer + 3 );
+      REQUIRE( result.ec == std::errc::value_too_large );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Floating Point
+//----------------------------------------------------------------------------
+
+TEST_CASE("from_chars( const char*, const char*, double&, chars_format )", "[parsing]")
+{
+  SECTION("Input is decimal")
+  {
+    auto value = 0.0;
+
+    SECTION("Parses the closest value")
+    {
+      bpstd::from_chars(bpstd::string_view{"0.1"}, value);
+      REQUIRE( value == 0.1 );
+
+      bpstd::from_chars(bpstd::string_view{"-1.5e-3"}, value);
+      REQUIRE( value == -1.5e-3 );
+
+      bpstd::from_chars(bpstd::string_view{"1.7976931348623157e308"}, value);
+      REQUIRE( value == std::numeric_limits<double>::max() );
+
+      bpstd::from_chars(bpstd::string_view{"4.9406564584124654e-324"}, value);
+      REQUIRE( value == std::numeric_limits<double>::denorm_min() );
+    }
+    SECTION("Rounds halfway cases to even")
+    {
+      // Exactly halfway between 1 and the next double
+      bpstd::from_chars(bpstd::string_view{"1.00000000000000011102230246251565404236316680908203125"}, value);
+      REQUIRE( value == 1.0 );
+
+      // Just above halfway
+      bpstd::from_chars(bpstd::string_view{"1.00000000000000011102230246251565404236316680908203126"}, value);
+      REQUIRE( value == 1.0000000000000002 );
+    }
+  }
+  SECTION("Input is an incomplete exponent")
+  {
+    const auto input = bpstd::string_view{"2e+"};
+    auto value = 0.0;
+
+    const auto result = bpstd::from_chars(input, value);
+
+    SECTION("Stops before the exponent")
+    {
+      REQUIRE( result.ptr == input.data() + 1 );
+      REQUIRE( value == 2.0 );
+    }
+  }
+  SECTION("Format is fixed")
+  {
+    const auto input = bpstd::string_view{"2e3"};
+    auto value = 0.0;
+
+    const auto result = bpstd::from_chars(input, value, bpstd::chars_format::fixed);
+
+    SECTION("Does not parse an exponent")
+    {
+      REQUIRE( result.ptr == input.data() + 1 );
+      REQUIRE( value == 2.0 );
+    }
+  }
+  SECTION("Format is scientific, and there is no exponent")
+  {
+    const auto input = bpstd::string_view{"2.5"};
+    auto value = 0.0;
+
+    const auto result = bpstd::from_chars(input, value, bpstd::chars_format::scientific);
+
+    SECTION("Reports the error")
+    {
+      REQUIRE( result.ec == std::errc::invalid_argument );
+    }
+  }
+  SECTION("Format is hex")
+  {
+    const auto input = bpstd::string_view{"-1.8p-1"};
+    auto value = 0.0;
+
+    const auto result = bpstd::from_chars(input, value, bpstd::chars_format::hex);
+
+    SECTION("Parses the value")
+    {
+      REQUIRE( result.ptr == input.data() + input.size() );
+      REQUIRE( value == -0.75 );
+    }
+  }
+  SECTION("Input is infinity or NaN")
+  {
+    auto value = 0.0;
+
+    SECTION("Parses the value in any case")
+    {
+      bpstd::from_chars(bpstd::string_view{"-INFinity"}, value);
+      REQUIRE( value == -std::numeric_limits<double>::infinity() );
+
+      bpstd::from_chars(bpstd::string_view{"nan(123)"}, value);
+      REQUIRE( std::isnan(value) );
+    }
+  }
+  SECTION("Input is out of range")
+  {
+    auto value = 42.0;
+
+    SECTION("Reports overflow and underflow")
+    {
+      REQUIRE( bpstd::from_chars(bpstd::string_view{"1e309"}, value).ec == std::errc::result_out_of_range );
+      REQUIRE( bpstd::from_chars(bpstd::string_view{"1e-400"}, value).ec == std::errc::result_out_of_range );
+      REQUIRE( value == 42.0 );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( char*, char*, double )", "[formatting]")
+{
+  SECTION("Writes the shortest digits that round-trip")
+  {
+    REQUIRE( format(0.1) == "0.1" );
+    REQUIRE( format(0.3) == "0.3" );
+    REQUIRE( format(1.0 / 3.0) == "0.3333333333333333" );
+    REQUIRE( format(5e-324) == "5e-324" );
+    REQUIRE( format(1.7976931348623157e308) == "1.7976931348623157e+308" );
+  }
+  SECTION("Writes the shorter of fixed and scientific")
+  {
+    REQUIRE( format(100.0) == "100" );
+    REQUIRE( format(1e20) == "1e+20" );
+    REQUIRE( format(0.0001) == "1e-04" );
+    REQUIRE( format(0.00015) == "0.00015" );
+  }
+  SECTION("Writes signed zeros, infinities and NaN")
+  {
+    REQUIRE( format(-0.0) == "-0" );
+    REQUIRE( format(std::numeric_limits<double>::infinity()) == "inf" );
+    REQUIRE( format(-std::numeric_limits<double>::quiet_NaN()) == "-nan" );
+  }
+  SECTION("Value is a float")
+  {
+    SECTION("Writes the shortest float digits")
+    {
+      REQUIRE( format(0.1f) == "0.1" );
+      REQUIRE( format(16777216.0f) == "16777216" );
+      REQUIRE( format(1e-45f) == "1e-45" );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( char*, char*, double, chars_format )", "[formatting]")
+{
+  SECTION("Format is fixed")
+  {
+    SECTION("Writes large values exactly")
+    {
+      REQUIRE( format(1e22, bpstd::chars_format::fixed) == "10000000000000000000000" );
+      REQUIRE( format(1e23, bpstd::chars_format::fixed) == "99999999999999991611392" );
+    }
+    SECTION("Writes small values with leading zeros")
+    {
+      REQUIRE( format(1.5e-7, bpstd::chars_format::fixed) == "0.00000015" );
+    }
+  }
+  SECTION("Format is scientific")
+  {
+    SECTION("Writes at least two exponent digits")
+    {
+      REQUIRE( format(123.0, bpstd::chars_format::scientific) == "1.23e+02" );
+      REQUIRE( format(0.0, bpstd::chars_format::scientific) == "0e+00" );
+      REQUIRE( format(1e-100, bpstd::chars_format::scientific) == "1e-100" );
+    }
+  }
+  SECTION("Format is general")
+  {
+    SECTION("Switches to scientific like %g")
+    {
+      REQUIRE( format(123456.0, bpstd::chars_format::general) == "123456" );
+      REQUIRE( format(1234567.0, bpstd::chars_format::general) == "1.234567e+06" );
+      REQUIRE( format(0.0001, bpstd::chars_format::general) == "0.0001" );
+      REQUIRE( format(0.00001, bpstd::chars_format::general) == "1e-05" );
+    }
+  }
+  SECTION("Format is hex")
+  {
+    SECTION("Writes the exact binary value")
+    {
+      REQUIRE( format(3.0, bpstd::chars_format::hex) == "1.8p+1" );
+      REQUIRE( format(0.1, bpstd::chars_format::hex) == "1.999999999999ap-4" );
+      REQUIRE( format(5e-324, bpstd::chars_format::hex) == "0.0000000000001p-1022" );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("to_chars( span<char>, double )", "[formatting]")
+{
+  SECTION("Value round-trips through from_chars")
+  {
+    const double values[] = {
+      0.1, 2.0 / 3.0, 1e-310, 123456789.125, 6.02214076e23, -2.5e-8
+    };
+    for (auto v : values) {
+      char buffer[32];
+      const auto written = bpstd::to_chars(bpstd::span<char>{buffer}, v);
+      auto parsed = 0.0;
+      const auto read = bpstd::from_chars(buffer, written.ptr, parsed);
+
+      REQUIRE( read.ptr == written.ptr );
+      REQUIRE( parsed == v );
+    }
+  }
+  SECTION("Buffer is too small")
+  {
+    char buffer[4];
+
+    const auto result = bpstd::to_chars(bpstd::span<char>{buffer}, 0.125);
+
+    SECTION("Reports the error")
+    {
+      REQUIRE( result.ptr == buffer + 4 );
+      REQUIRE( result.ec == std::errc::value_too_large );
+    }
+  }
+}
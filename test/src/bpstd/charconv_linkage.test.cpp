@@ -0,0 +1,66 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+// This file is deliberately a second translation unit that includes
+// 'charconv.hpp', so that any definition in the header that is not 'inline'
+// or a template fails to link with 'charconv.test.cpp'.
+
+#include <bpstd/charconv.hpp>
+
+#include <string> // std::string
+
+#include <catch2/catch.hpp>
+
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+TEST_CASE("charconv.hpp is usable from several translation units", "[linkage]")
+{
+  SECTION("double round trips")
+  {
+    char buffer[64];
+    const auto written = bpstd::to_chars(buffer, buffer + sizeof(buffer), 0.1);
+    REQUIRE( written.ec == std::errc{} );
+
+    auto value = double{};
+    const auto parsed = bpstd::from_chars(buffer, written.ptr, value);
+
+    REQUIRE( parsed.ec == std::errc{} );
+    REQUIRE( std::string(buffer, written.ptr) == "0.1" );
+    REQUIRE( value == 0.1 );
+  }
+  SECTION("float round trips")
+  {
+    char buffer[64];
+    const auto written = bpstd::to_chars(buffer, buffer + sizeof(buffer), 1.5f);
+    REQUIRE( written.ec == std::errc{} );
+
+    auto value = float{};
+    const auto parsed = bpstd::from_chars(buffer, written.ptr, value);
+
+    REQUIRE( parsed.ec == std::errc{} );
+    REQUIRE( value == 1.5f );
+  }
+}
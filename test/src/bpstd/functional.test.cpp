@@ -23,10 +23,13 @@
 */
 
 #include <bpstd/functional.hpp>
+#include <bpstd/string_view.hpp>
+#include <bpstd/span.hpp>
 
 #include <catch2/catch.hpp>
-#include <memory> // std::shared_ptr
+#include <memory> // std::shared_ptr, std::unique_ptr
 #include <functional> // std::reference_wrapper
+#include <cctype> // std::tolower
 
 // MSVC 2015 seems to emit an error that __forceinline'd functions may not be
 // __forceinline'd at the *end of the translation unit* using it, for some
@@ -482,3 +485,530 @@ TEST_CASE("not_fn(...)", "[functional]")
     }
   }
 }
+
+//==============================================================================
+// class : function_ref
+//==============================================================================
+
+static_assert(
+  sizeof(bpstd::function_ref<bool(int)>) == 2u * sizeof(void*),
+  "function_ref must be two pointers in size"
+);
+static_assert(
+  std::is_trivially_copyable<bpstd::function_ref<bool(int)>>::value,
+  "function_ref must be trivially copyable"
+);
+static_assert(
+  !std::is_constructible<bpstd::function_ref<bool(int)>,::clazz&>::value,
+  "function_ref must not be constructible from non-callable types"
+);
+static_assert(
+  !std::is_constructible<bpstd::function_ref<bool(int)>,bool(*)(int,int)>::value,
+  "function_ref must not be constructible from a function with a different signature"
+);
+
+TEST_CASE("function_ref::operator()(Args...)", "[functional]")
+{
+  SECTION("Function is callable object")
+  {
+    SECTION("Call is const")
+    {
+      const auto fn = ::const_functor{42};
+      auto sut = bpstd::function_ref<bool(int)>{fn};
+
+      REQUIRE(sut(42));
+    }
+    SECTION("Call is non-const")
+    {
+      auto fn = ::mutable_functor{42};
+      auto sut = bpstd::function_ref<bool(int)>{fn};
+
+      REQUIRE(sut(42));
+    }
+    SECTION("Callable is lambda with state")
+    {
+      auto count = 0;
+      auto fn = [&count](int x) { count += x; };
+      auto sut = bpstd::function_ref<void(int)>{fn};
+
+      sut(1);
+      sut(2);
+
+      REQUIRE(count == 3);
+    }
+    SECTION("Callable is modified after being referenced")
+    {
+      auto fn = ::mutable_functor{0};
+      auto sut = bpstd::function_ref<bool(int)>{fn};
+
+      fn.y = 42;
+
+      REQUIRE(sut(42));
+    }
+  }
+  SECTION("Function is non-member function")
+  {
+    SECTION("Function is pointer")
+    {
+      auto sut = bpstd::function_ref<bool(int,int)>{&::equal};
+
+      REQUIRE(sut(42, 42));
+    }
+    SECTION("Function is reference")
+    {
+      auto sut = bpstd::function_ref<bool(int,int)>{::nothrow_equal};
+
+      REQUIRE(sut(42, 42));
+    }
+  }
+  SECTION("Function is member function")
+  {
+    auto sut = ::clazz{42};
+
+    SECTION("'this' is pointer")
+    {
+      const auto fn = &::clazz::compare;
+      auto ref = bpstd::function_ref<bool(::clazz*,int)>{fn};
+
+      REQUIRE(ref(&sut, 42));
+    }
+    SECTION("'this' is reference")
+    {
+      const auto fn = &::clazz::const_compare;
+      auto ref = bpstd::function_ref<bool(const ::clazz&,int)>{fn};
+
+      REQUIRE(ref(sut, 42));
+    }
+  }
+  SECTION("Function is member data")
+  {
+    auto sut = ::clazz{42};
+    const auto fn = &::clazz::y;
+    auto ref = bpstd::function_ref<int(const ::clazz&)>{fn};
+
+    REQUIRE(ref(sut) == 42);
+  }
+  SECTION("Result is converted to R")
+  {
+    auto fn = [](int x) { return x; };
+    auto sut = bpstd::function_ref<long(int)>{fn};
+
+    REQUIRE(sut(42) == 42l);
+  }
+  SECTION("Result is discarded")
+  {
+    auto sut = bpstd::function_ref<void(int,int)>{&::equal};
+
+    sut(42, 42);
+  }
+  SECTION("Arguments are forwarded")
+  {
+    auto fn = [](std::unique_ptr<int> p) { return *p; };
+    auto sut = bpstd::function_ref<int(std::unique_ptr<int>)>{fn};
+
+    REQUIRE(sut(std::unique_ptr<int>{new int{42}}) == 42);
+  }
+  SECTION("Reference is rebound by assignment")
+  {
+    auto fn0 = ::const_functor{0};
+    auto fn1 = ::const_functor{42};
+    auto sut = bpstd::function_ref<bool(int)>{fn0};
+
+    sut = fn1;
+
+    REQUIRE(sut(42));
+  }
+}
+
+//==============================================================================
+// class : basic_unique_function
+//==============================================================================
+
+static_assert(
+  !std::is_copy_constructible<bpstd::unique_function<int()>>::value,
+  "unique_function must not be copy-constructible"
+);
+static_assert(
+  std::is_nothrow_move_constructible<bpstd::unique_function<int()>>::value,
+  "unique_function must be nothrow move-constructible"
+);
+static_assert(
+  std::is_constructible<bpstd::unique_function<int()>,int(*)()>::value,
+  "unique_function must be constructible from a function pointer"
+);
+static_assert(
+  !std::is_constructible<bpstd::unique_function<int()>,::clazz>::value,
+  "unique_function must not be constructible from non-callable types"
+);
+
+namespace {
+
+  // A move-only callable that fits within the default internal buffer
+  struct move_only_functor
+  {
+    explicit move_only_functor(int v) : value{new int{v}}{}
+
+    int operator()() const { return *value; }
+
+    std::unique_ptr<int> value;
+  };
+
+  // A move-only callable that is too large for the default internal buffer
+  struct large_move_only_functor
+  {
+    explicit large_move_only_functor(int v) : value{new int{v}}, buffer{}{}
+
+    int operator()() const { return *value; }
+
+    std::unique_ptr<int> value;
+    char buffer[sizeof(bpstd::unique_function<int()>)];
+  };
+
+} // anonymous namespace
+
+TEST_CASE("basic_unique_function::basic_unique_function()", "[functional]")
+{
+  auto sut = bpstd::unique_function<int()>{};
+
+  SECTION("Does not contain a callable")
+  {
+    REQUIRE_FALSE(static_cast<bool>(sut));
+    REQUIRE(sut == nullptr);
+  }
+  SECTION("Throws bad_function_call when invoked")
+  {
+    REQUIRE_THROWS_AS(sut(), std::bad_function_call);
+  }
+}
+
+TEST_CASE("basic_unique_function::basic_unique_function( Fn&& )", "[functional]")
+{
+  SECTION("Callable is move-only and fits in the internal buffer")
+  {
+    auto sut = bpstd::unique_function<int()>{::move_only_functor{42}};
+
+    SECTION("Contains a callable")
+    {
+      REQUIRE(sut != nullptr);
+    }
+    SECTION("Invokes the callable")
+    {
+      REQUIRE(sut() == 42);
+    }
+  }
+  SECTION("Callable is move-only and exceeds the internal buffer")
+  {
+    auto sut = bpstd::unique_function<int()>{::large_move_only_functor{42}};
+
+    SECTION("Invokes the callable")
+    {
+      REQUIRE(sut() == 42);
+    }
+  }
+  SECTION("Callable is a function pointer")
+  {
+    auto sut = bpstd::unique_function<bool(int,int)>{&::equal};
+
+    REQUIRE(sut(42, 42));
+  }
+  SECTION("Callable is a member function pointer")
+  {
+    auto c = ::clazz{42};
+    auto sut = bpstd::unique_function<bool(::clazz&,int)>{&::clazz::compare};
+
+    REQUIRE(sut(c, 42));
+  }
+  SECTION("Callable is a null function pointer")
+  {
+    using function_type = bool(*)(int,int);
+    auto sut = bpstd::unique_function<bool(int,int)>{function_type{nullptr}};
+
+    REQUIRE(sut == nullptr);
+  }
+  SECTION("Result is discarded")
+  {
+    auto count = 0;
+    auto sut = bpstd::unique_function<void()>{[&count]{ return ++count; }};
+
+    sut();
+
+    REQUIRE(count == 1);
+  }
+}
+
+TEST_CASE("basic_unique_function::basic_unique_function( basic_unique_function&& )", "[functional]")
+{
+  SECTION("Callable is stored internally")
+  {
+    auto original = bpstd::unique_function<int()>{[]{ return 42; }};
+    auto sut = std::move(original);
+
+    SECTION("Original no longer contains a callable")
+    {
+      REQUIRE(original == nullptr);
+    }
+    SECTION("Result invokes the callable")
+    {
+      REQUIRE(sut() == 42);
+    }
+  }
+  SECTION("Callable is stored externally")
+  {
+    auto original = bpstd::unique_function<int()>{::large_move_only_functor{42}};
+    auto sut = std::move(original);
+
+    SECTION("Original no longer contains a callable")
+    {
+      REQUIRE(original == nullptr);
+    }
+    SECTION("Result invokes the callable")
+    {
+      REQUIRE(sut() == 42);
+    }
+  }
+}
+
+TEST_CASE("basic_unique_function::operator=( basic_unique_function&& )", "[functional]")
+{
+  auto source = bpstd::unique_function<int()>{::large_move_only_functor{42}};
+  auto sut = bpstd::unique_function<int()>{[]{ return 0; }};
+
+  sut = std::move(source);
+
+  SECTION("Source no longer contains a callable")
+  {
+    REQUIRE(source == nullptr);
+  }
+  SECTION("Destination invokes the source's callable")
+  {
+    REQUIRE(sut() == 42);
+  }
+}
+
+TEST_CASE("basic_unique_function::operator=( std::nullptr_t )", "[functional]")
+{
+  auto sut = bpstd::unique_function<int()>{::large_move_only_functor{42}};
+
+  sut = nullptr;
+
+  REQUIRE(sut == nullptr);
+}
+
+TEST_CASE("basic_unique_function::swap( basic_unique_function& )", "[functional]")
+{
+  SECTION("Both contain callables")
+  {
+    auto lhs = bpstd::unique_function<int()>{[]{ return 42; }};
+    auto rhs = bpstd::unique_function<int()>{::large_move_only_functor{24}};
+
+    lhs.swap(rhs);
+
+    SECTION("Left invokes right's old callable")
+    {
+      REQUIRE(lhs() == 24);
+    }
+    SECTION("Right invokes left's old callable")
+    {
+      REQUIRE(rhs() == 42);
+    }
+  }
+  SECTION("One is empty")
+  {
+    auto lhs = bpstd::unique_function<int()>{[]{ return 42; }};
+    auto rhs = bpstd::unique_function<int()>{};
+
+    swap(lhs, rhs);
+
+    SECTION("Left is empty")
+    {
+      REQUIRE(lhs == nullptr);
+    }
+    SECTION("Right invokes left's old callable")
+    {
+      REQUIRE(rhs() == 42);
+    }
+  }
+}
+
+TEST_CASE("inplace_function::operator()(Args...)", "[functional]")
+{
+  auto sut = bpstd::inplace_function<int(), 64u>{
+    ::large_move_only_functor{42}
+  };
+
+  SECTION("Invokes the callable from the internal buffer")
+  {
+    REQUIRE(sut() == 42);
+  }
+}
+
+//==============================================================================
+// Searchers
+//==============================================================================
+
+namespace {
+
+  struct case_insensitive_hash
+  {
+    std::size_t operator()(char c) const
+    {
+      return std::hash<int>{}(std::tolower(static_cast<unsigned char>(c)));
+    }
+  };
+
+  struct case_insensitive_equal
+  {
+    bool operator()(char lhs, char rhs) const
+    {
+      return std::tolower(static_cast<unsigned char>(lhs)) ==
+             std::tolower(static_cast<unsigned char>(rhs));
+    }
+  };
+
+} // namespace <anonymous>
+
+TEST_CASE("default_searcher::operator()( ForwardIt2, ForwardIt2 )", "[functional]")
+{
+  const auto haystack = bpstd::string_view{"the quick brown fox"};
+  const auto needle = bpstd::string_view{"brown"};
+  const auto sut = bpstd::make_default_searcher(needle.begin(), needle.end());
+
+  SECTION("Pattern is in the range")
+  {
+    const auto result = sut(haystack.begin(), haystack.end());
+
+    SECTION("Returns the matching range")
+    {
+      REQUIRE(result.first == haystack.begin() + 10);
+      REQUIRE(result.second == haystack.begin() + 15);
+    }
+  }
+  SECTION("Pattern is not in the range")
+  {
+    const auto result = sut(haystack.begin(), haystack.begin() + 12);
+
+    SECTION("Returns an empty range at the end")
+    {
+      REQUIRE(result.first == haystack.begin() + 12);
+      REQUIRE(result.second == haystack.begin() + 12);
+    }
+  }
+}
+
+TEST_CASE("boyer_moore_horspool_searcher::operator()( RandomIt2, RandomIt2 )", "[functional]")
+{
+  SECTION("Pattern is a string_view")
+  {
+    const auto haystack = bpstd::string_view{"abcabcabcabd"};
+    const auto needle = bpstd::string_view{"abcabd"};
+    const auto sut = bpstd::make_boyer_moore_horspool_searcher(needle.begin(), needle.end());
+
+    SECTION("Finds the first match")
+    {
+      const auto result = sut(haystack.begin(), haystack.end());
+
+      REQUIRE(result.first == haystack.begin() + 6);
+      REQUIRE(result.second == haystack.end());
+    }
+    SECTION("Searcher is reused on another range")
+    {
+      const auto other = bpstd::string_view{"xxabcabdxx"};
+      const auto result = sut(other.begin(), other.end());
+
+      SECTION("Finds the match in that range")
+      {
+        REQUIRE(result.first == other.begin() + 2);
+      }
+    }
+    SECTION("Range is shorter than the pattern")
+    {
+      const auto result = sut(haystack.begin(), haystack.begin() + 3);
+
+      SECTION("Returns an empty range at the end")
+      {
+        REQUIRE(result.first == haystack.begin() + 3);
+        REQUIRE(result.second == haystack.begin() + 3);
+      }
+    }
+  }
+  SECTION("Pattern is a span of integers")
+  {
+    const int haystack_values[] = {1, 2, 300, 4, 300, 4, 5, 6};
+    const int needle_values[] = {300, 4, 5};
+    const auto haystack = bpstd::span<const int>{haystack_values};
+    const auto needle = bpstd::span<const int>{needle_values};
+    const auto sut = bpstd::make_boyer_moore_horspool_searcher(needle.begin(), needle.end());
+
+    SECTION("Finds the first match")
+    {
+      const auto result = sut(haystack.begin(), haystack.end());
+
+      REQUIRE(result.first == haystack.begin() + 4);
+      REQUIRE(result.second == haystack.begin() + 7);
+    }
+  }
+  SECTION("Pattern is empty")
+  {
+    const auto haystack = bpstd::string_view{"abc"};
+    const auto needle = bpstd::string_view{};
+    const auto sut = bpstd::make_boyer_moore_horspool_searcher(needle.begin(), needle.end());
+
+    SECTION("Returns an empty range at the start")
+    {
+      const auto result = sut(haystack.begin(), haystack.end());
+
+      REQUIRE(result.first == haystack.begin());
+      REQUIRE(result.second == haystack.begin());
+    }
+  }
+}
+
+TEST_CASE("boyer_moore_searcher::operator()( RandomIt2, RandomIt2 )", "[functional]")
+{
+  SECTION("Pattern repeats its own suffix")
+  {
+    const auto haystack = bpstd::string_view{"aabaabaabaababaabaab"};
+    const auto needle = bpstd::string_view{"abaababaab"};
+    const auto sut = bpstd::make_boyer_moore_searcher(needle.begin(), needle.end());
+
+    SECTION("Finds the first match")
+    {
+      const auto result = sut(haystack.begin(), haystack.end());
+
+      REQUIRE(result.first == haystack.begin() + 7);
+      REQUIRE(result.second == haystack.begin() + 17);
+    }
+  }
+  SECTION("Pattern is not in the range")
+  {
+    const auto haystack = bpstd::string_view{"aaaaaaaaaa"};
+    const auto needle = bpstd::string_view{"baa"};
+    const auto sut = bpstd::make_boyer_moore_searcher(needle.begin(), needle.end());
+
+    SECTION("Returns an empty range at the end")
+    {
+      const auto result = sut(haystack.begin(), haystack.end());
+
+      REQUIRE(result.first == haystack.end());
+      REQUIRE(result.second == haystack.end());
+    }
+  }
+  SECTION("Searcher uses a custom predicate")
+  {
+    const auto haystack = bpstd::string_view{"Hello, World"};
+    const auto needle = bpstd::string_view{"WORLD"};
+    const auto sut = bpstd::make_boyer_moore_searcher(
+      needle.begin(),
+      needle.end(),
+      case_insensitive_hash{},
+      case_insensitive_equal{}
+    );
+
+    SECTION("Finds matches by that predicate")
+    {
+      const auto result = sut(haystack.begin(), haystack.end());
+
+      REQUIRE(result.first == haystack.begin() + 7);
+    }
+  }
+}
@@ -0,0 +1,301 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/mapped_file.hpp>
+
+#include <catch2/catch.hpp>
+
+#if BPSTD_HAS_MAPPED_FILE
+
+#include <cstdio>       // std::remove
+#include <cstdlib>      // ::mkstemp
+#include <string>       // std::string
+#include <stdexcept>    // std::out_of_range
+#include <system_error> // std::system_error
+#include <unistd.h>     // ::write, ::close
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  /// \brief A file with the given contents, that is removed on destruction
+  class temporary_file
+  {
+  public:
+    explicit temporary_file(const std::string& contents)
+      : m_path{"/tmp/bpstd-mapped-file-XXXXXX"}
+    {
+      const auto fd = ::mkstemp(&m_path[0]);
+      REQUIRE(fd >= 0);
+
+      auto remaining = contents.size();
+      auto* p = contents.data();
+      while (remaining > 0u) {
+        const auto written = ::write(fd, p, remaining);
+        REQUIRE(written > 0);
+        remaining -= static_cast<std::size_t>(written);
+        p += written;
+      }
+      ::close(fd);
+    }
+
+    ~temporary_file()
+    {
+      std::remove(m_path.c_str());
+    }
+
+    const std::string& path() const noexcept { return m_path; }
+
+  private:
+    std::string m_path;
+  };
+
+} // namespace <anonymous>
+
+TEST_CASE("mapped_file::mapped_file()", "[ctor]")
+{
+  const auto sut = bpstd::mapped_file{};
+
+  SECTION("Is not open")
+  {
+    REQUIRE_FALSE(sut.is_open());
+  }
+  SECTION("Is empty")
+  {
+    REQUIRE(sut.empty());
+    REQUIRE(sut.data() == nullptr);
+    REQUIRE(sut.view().empty());
+  }
+}
+
+TEST_CASE("mapped_file::mapped_file( const std::string&, access_advice )", "[ctor]")
+{
+  SECTION("File exists")
+  {
+    const auto contents = std::string{"hello world"};
+    const auto file = temporary_file{contents};
+
+    const auto sut = bpstd::mapped_file{
+      file.path(),
+      bpstd::mapped_file::access_advice::sequential
+    };
+
+    SECTION("Is open")
+    {
+      REQUIRE(sut.is_open());
+    }
+    SECTION("Maps the contents of the file")
+    {
+      REQUIRE(sut.size() == contents.size());
+      REQUIRE(sut.view() == contents);
+    }
+  }
+  SECTION("File is empty")
+  {
+    const auto file = temporary_file{""};
+
+    const auto sut = bpstd::mapped_file{file.path()};
+
+    SECTION("Is open")
+    {
+      REQUIRE(sut.is_open());
+    }
+    SECTION("Is empty")
+    {
+      REQUIRE(sut.empty());
+      REQUIRE(sut.view().empty());
+      REQUIRE(sut.bytes().empty());
+    }
+  }
+  SECTION("File does not exist")
+  {
+    SECTION("Throws std::system_error")
+    {
+      REQUIRE_THROWS_AS(
+        bpstd::mapped_file{"/bpstd/this/path/does/not/exist"},
+        std::system_error
+      );
+    }
+  }
+}
+
+TEST_CASE("mapped_file::mapped_file( mapped_file&& )", "[ctor]")
+{
+  const auto contents = std::string{"hello world"};
+  const auto file = temporary_file{contents};
+  auto original = bpstd::mapped_file{file.path()};
+
+  const auto sut = bpstd::mapped_file{std::move(original)};
+
+  SECTION("Takes the mapping")
+  {
+    REQUIRE(sut.view() == contents);
+  }
+  SECTION("Leaves the original closed")
+  {
+    REQUIRE_FALSE(original.is_open());
+    REQUIRE(original.empty());
+  }
+}
+
+TEST_CASE("mapped_file::operator=( mapped_file&& )", "[assignment]")
+{
+  const auto file0 = temporary_file{"hello"};
+  const auto file1 = temporary_file{"goodbye"};
+  auto sut = bpstd::mapped_file{file0.path()};
+  auto other = bpstd::mapped_file{file1.path()};
+
+  sut = std::move(other);
+
+  SECTION("Takes the mapping")
+  {
+    REQUIRE(sut.view() == "goodbye");
+  }
+  SECTION("Leaves the original closed")
+  {
+    REQUIRE_FALSE(other.is_open());
+  }
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+
+TEST_CASE("mapped_file::open( const std::string&, access_advice )", "[modifiers]")
+{
+  const auto file0 = temporary_file{"hello"};
+  const auto file1 = temporary_file{"goodbye"};
+  auto sut = bpstd::mapped_file{file0.path()};
+
+  SECTION("File exists")
+  {
+    sut.open(file1.path());
+
+    SECTION("Maps the new file")
+    {
+      REQUIRE(sut.view() == "goodbye");
+    }
+  }
+  SECTION("File does not exist")
+  {
+    REQUIRE_THROWS_AS(
+      sut.open("/bpstd/this/path/does/not/exist"),
+      std::system_error
+    );
+
+    SECTION("Closes the previous file")
+    {
+      REQUIRE_FALSE(sut.is_open());
+    }
+  }
+}
+
+TEST_CASE("mapped_file::close()", "[modifiers]")
+{
+  const auto file = temporary_file{"hello"};
+  auto sut = bpstd::mapped_file{file.path()};
+
+  sut.close();
+
+  SECTION("Is not open")
+  {
+    REQUIRE_FALSE(sut.is_open());
+    REQUIRE(sut.empty());
+  }
+}
+
+//------------------------------------------------------------------------------
+// Views
+//------------------------------------------------------------------------------
+
+TEST_CASE("mapped_file::view( size_type, size_type )", "[views]")
+{
+  const auto file = temporary_file{"hello world"};
+  const auto sut = bpstd::mapped_file{file.path()};
+
+  SECTION("Range is within the file")
+  {
+    REQUIRE(sut.view(6u, 3u) == "wor");
+  }
+  SECTION("Range extends past the end of the file")
+  {
+    REQUIRE(sut.view(6u) == "world");
+  }
+  SECTION("Position is the end of the file")
+  {
+    REQUIRE(sut.view(sut.size()).empty());
+  }
+  SECTION("Position is past the end of the file")
+  {
+    REQUIRE_THROWS_AS(sut.view(sut.size() + 1u), std::out_of_range);
+  }
+}
+
+TEST_CASE("mapped_file::bytes( size_type, size_type )", "[views]")
+{
+  const auto file = temporary_file{"hello world"};
+  const auto sut = bpstd::mapped_file{file.path()};
+
+  SECTION("Views the same memory as view()")
+  {
+    const auto bytes = sut.bytes(6u, 3u);
+    const auto view = sut.view(6u, 3u);
+
+    REQUIRE(bytes.size() == view.size());
+    REQUIRE(static_cast<const void*>(bytes.data()) == view.data());
+  }
+  SECTION("Position is past the end of the file")
+  {
+    REQUIRE_THROWS_AS(sut.bytes(sut.size() + 1u), std::out_of_range);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Paging
+//------------------------------------------------------------------------------
+
+TEST_CASE("mapped_file::advise( access_advice, size_type, size_type )", "[paging]")
+{
+  // Larger than a page, so that advice applies to an unaligned range
+  const auto contents = std::string(3u * 4096u + 17u, 'x');
+  const auto file = temporary_file{contents};
+  auto sut = bpstd::mapped_file{file.path()};
+
+  SECTION("Does not change the contents of the mapping")
+  {
+    sut.advise(bpstd::mapped_file::access_advice::will_need, 4097u, 100u);
+    sut.advise(bpstd::mapped_file::access_advice::random, 5000u);
+    sut.advise(bpstd::mapped_file::access_advice::dont_need);
+    sut.advise(bpstd::mapped_file::access_advice::normal, sut.size() + 1u);
+
+    REQUIRE(sut.view() == contents);
+  }
+}
+
+#endif /* BPSTD_HAS_MAPPED_FILE */
@@ -55,8 +55,91 @@ namespace {
   private:
     bool& m_is_called;
   };
+
+  // Counts the number of copies and moves made of an object
+  struct copy_counts
+  {
+    int copies;
+    int moves;
+  };
+
+  class copy_counter
+  {
+  public:
+    explicit copy_counter(copy_counts& counts) : m_counts(&counts){}
+    copy_counter(const copy_counter& other)
+      : m_counts(other.m_counts)
+    {
+      ++m_counts->copies;
+    }
+    copy_counter(copy_counter&& other) noexcept
+      : m_counts(other.m_counts)
+    {
+      ++m_counts->moves;
+    }
+
+    copy_counts& counts() const noexcept { return *m_counts; }
+
+  private:
+    copy_counts* m_counts;
+  };
+
+  struct add_one
+  {
+    constexpr int operator()(int x) const { return x + 1; }
+  };
+
+  struct half_if_even
+  {
+    constexpr bpstd::optional<int> operator()(int x) const
+    {
+      return (x % 2 == 0) ? bpstd::optional<int>{x / 2} : bpstd::optional<int>{};
+    }
+  };
+
+  // An index that is never negative, which uses -1 as its sentinel
+  struct sentinel_index
+  {
+    int value;
+  };
+
+  // A handle that is never null, which uses nullptr as its sentinel
+  struct sentinel_handle
+  {
+    const int* pointer;
+  };
 } // anonymous namespace
 
+namespace bpstd {
+
+  template <>
+  struct optional_sentinel_traits<::sentinel_index>
+  {
+    static constexpr ::sentinel_index sentinel() noexcept
+    {
+      return ::sentinel_index{-1};
+    }
+    static constexpr bool is_sentinel(const ::sentinel_index& index) noexcept
+    {
+      return index.value == -1;
+    }
+  };
+
+  template <>
+  struct optional_sentinel_traits<::sentinel_handle>
+  {
+    static constexpr ::sentinel_handle sentinel() noexcept
+    {
+      return ::sentinel_handle{nullptr};
+    }
+    static constexpr bool is_sentinel(const ::sentinel_handle& handle) noexcept
+    {
+      return handle.pointer == nullptr;
+    }
+  };
+
+} // namespace bpstd
+
 static_assert(
   std::is_trivially_destructible<int>::value == std::is_trivially_destructible<bpstd::optional<int>>::value,
   "optional should have the same trivial destructibility as the wrapped type"
@@ -660,3 +743,279 @@ TEST_CASE("optional::emplace( std::initializer_list<U>, Args&&... )","[modifiers
     // TODO(bitwizeshift): Add unit tests
   }
 }
+
+//=============================================================================
+// trait : optional_sentinel_traits
+//=============================================================================
+
+static_assert(
+  sizeof(bpstd::optional<::sentinel_index>) == sizeof(::sentinel_index),
+  "optional with a sentinel must not store a separate flag"
+);
+static_assert(
+  sizeof(bpstd::optional<::sentinel_handle>) == sizeof(::sentinel_handle),
+  "optional with a sentinel must not store a separate flag"
+);
+static_assert(
+  sizeof(bpstd::optional<int>) > sizeof(int),
+  "optional without a sentinel stores a separate flag"
+);
+static_assert(
+  !bpstd::optional<::sentinel_index>{}.has_value(),
+  "optional with a sentinel must be usable in constant expressions"
+);
+
+TEST_CASE("optional<T> with optional_sentinel_traits<T>","[sentinel]")
+{
+  SECTION("Default constructed")
+  {
+    auto sut = bpstd::optional<::sentinel_index>{};
+
+    SECTION("Does not contain a value")
+    {
+      REQUIRE_FALSE(sut.has_value());
+    }
+  }
+
+  SECTION("Constructed with a value")
+  {
+    auto sut = bpstd::optional<::sentinel_index>{::sentinel_index{42}};
+
+    SECTION("Contains a value")
+    {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("Value is same as input")
+    {
+      REQUIRE(sut->value == 42);
+    }
+  }
+
+  SECTION("Copied from an optional with a value")
+  {
+    const auto value = 42;
+    const auto original = bpstd::optional<::sentinel_handle>{::sentinel_handle{&value}};
+    const auto sut = original;
+
+    SECTION("Copy contains the same value")
+    {
+      REQUIRE(sut->pointer == &value);
+    }
+  }
+
+  SECTION("Reset after containing a value")
+  {
+    auto sut = bpstd::optional<::sentinel_index>{::sentinel_index{42}};
+
+    sut.reset();
+
+    SECTION("Does not contain a value")
+    {
+      REQUIRE_FALSE(sut.has_value());
+    }
+  }
+
+  SECTION("Assigned nullopt after containing a value")
+  {
+    auto sut = bpstd::optional<::sentinel_index>{::sentinel_index{42}};
+
+    sut = bpstd::nullopt;
+
+    SECTION("Does not contain a value")
+    {
+      REQUIRE_FALSE(sut.has_value());
+    }
+  }
+
+  SECTION("Emplaced after not containing a value")
+  {
+    auto sut = bpstd::optional<::sentinel_index>{};
+
+    sut.emplace(::sentinel_index{42});
+
+    SECTION("Contains a value")
+    {
+      REQUIRE(sut.has_value());
+    }
+    SECTION("Value is same as input")
+    {
+      REQUIRE(sut->value == 42);
+    }
+  }
+}
+
+//=============================================================================
+// Monadic Operations
+//=============================================================================
+
+namespace {
+  constexpr auto monadic_value = bpstd::optional<int>{41};
+  constexpr auto monadic_empty = bpstd::optional<int>{};
+} // anonymous namespace
+
+static_assert(
+  monadic_value.transform(::add_one{}).has_value(),
+  "transform must be usable in constant expressions"
+);
+static_assert(
+  !monadic_empty.transform(::add_one{}).has_value(),
+  "transform must be usable in constant expressions"
+);
+static_assert(
+  !monadic_value.and_then(::half_if_even{}).has_value(),
+  "and_then must be usable in constant expressions"
+);
+
+#if __cplusplus >= 201402L
+// Accessing the result, and chaining, are only constant-evaluable once the
+// rvalue overloads are 'constexpr', which requires C++14. A chain that folds
+// away at compile time is also one that the optimizer is able to reduce to
+// straight-line code.
+static_assert(
+  *monadic_value.transform(::add_one{}) == 42,
+  "transform must be usable in constant expressions"
+);
+static_assert(
+  *bpstd::optional<int>{3}
+    .transform(::add_one{})
+    .and_then(::half_if_even{})
+    .transform(::add_one{}) == 3,
+  "chained monadic operations must be usable in constant expressions"
+);
+#endif
+
+TEST_CASE("optional::and_then( Fn&& )","[monadic]")
+{
+  const auto fn = [](int x) -> bpstd::optional<std::string> {
+    if (x < 0) {
+      return bpstd::nullopt;
+    }
+    return std::to_string(x);
+  };
+
+  SECTION("Optional is empty")
+  {
+    auto sut = bpstd::optional<int>{};
+
+    SECTION("Result is empty")
+    {
+      REQUIRE_FALSE(sut.and_then(fn).has_value());
+    }
+  }
+  SECTION("Optional contains a value")
+  {
+    SECTION("Function returns a value")
+    {
+      auto sut = bpstd::optional<int>{42};
+
+      REQUIRE(sut.and_then(fn) == std::string{"42"});
+    }
+    SECTION("Function returns nullopt")
+    {
+      auto sut = bpstd::optional<int>{-1};
+
+      REQUIRE_FALSE(sut.and_then(fn).has_value());
+    }
+  }
+}
+
+TEST_CASE("optional::transform( Fn&& )","[monadic]")
+{
+  SECTION("Optional is empty")
+  {
+    auto called = false;
+    auto sut = bpstd::optional<int>{};
+
+    auto result = sut.transform([&](int x) { called = true; return x; });
+
+    SECTION("Result is empty")
+    {
+      REQUIRE_FALSE(result.has_value());
+    }
+    SECTION("Function is not called")
+    {
+      REQUIRE_FALSE(called);
+    }
+  }
+  SECTION("Optional contains a value")
+  {
+    const auto sut = bpstd::optional<int>{21};
+
+    auto result = sut.transform([](int x) { return x * 2.0; });
+
+    SECTION("Result contains the function's result")
+    {
+      REQUIRE(result == 42.0);
+    }
+  }
+  SECTION("Function result is neither copied nor moved")
+  {
+    auto counts = ::copy_counts{0, 0};
+
+    auto result = bpstd::optional<int>{42}.transform([&](int) {
+      return ::copy_counter{counts};
+    });
+
+    REQUIRE(result.has_value());
+    REQUIRE(counts.copies == 0);
+    REQUIRE(counts.moves == 0);
+  }
+  SECTION("Rvalue optional moves its value into the function")
+  {
+    auto counts = ::copy_counts{0, 0};
+    auto sut = bpstd::optional<::copy_counter>{bpstd::in_place, counts};
+
+    auto result = bpstd::move(sut)
+      .transform([](::copy_counter&& c) { return ::copy_counter{bpstd::move(c)}; })
+      .transform([](::copy_counter&& c) { return ::copy_counter{bpstd::move(c)}; });
+
+    SECTION("Result contains a value")
+    {
+      REQUIRE(result.has_value());
+    }
+    SECTION("Value is never copied")
+    {
+      REQUIRE(counts.copies == 0);
+    }
+    SECTION("Value is only moved by the functions")
+    {
+      REQUIRE(counts.moves == 2);
+    }
+  }
+}
+
+TEST_CASE("optional::or_else( Fn&& )","[monadic]")
+{
+  const auto fn = []{ return bpstd::optional<int>{42}; };
+
+  SECTION("Optional is empty")
+  {
+    auto sut = bpstd::optional<int>{};
+
+    SECTION("Returns the function's result")
+    {
+      REQUIRE(sut.or_else(fn) == 42);
+    }
+  }
+  SECTION("Optional contains a value")
+  {
+    auto sut = bpstd::optional<int>{0};
+
+    SECTION("Returns the value")
+    {
+      REQUIRE(sut.or_else(fn) == 0);
+    }
+  }
+  SECTION("Rvalue optional is moved, not copied")
+  {
+    auto counts = ::copy_counts{0, 0};
+    auto sut = bpstd::optional<::copy_counter>{bpstd::in_place, counts};
+
+    auto result = bpstd::move(sut).or_else([&]{
+      return bpstd::optional<::copy_counter>{bpstd::in_place, counts};
+    });
+
+    REQUIRE(result.has_value());
+    REQUIRE(counts.copies == 0);
+  }
+}
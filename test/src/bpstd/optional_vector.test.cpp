@@ -0,0 +1,308 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2016 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/optional_vector.hpp>
+
+#include <catch2/catch.hpp>
+#include <cstddef> // std::size_t
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  // Creates an optional_vector of \p count elements, where every element
+  // whose index is a multiple of \p stride contains its index
+  bpstd::optional_vector<int> make_strided(std::size_t count, std::size_t stride)
+  {
+    auto result = bpstd::optional_vector<int>{};
+    for (auto i = 0u; i < count; ++i) {
+      if (i % stride == 0u) {
+        result.push_back(static_cast<int>(i));
+      } else {
+        result.push_back(bpstd::nullopt);
+      }
+    }
+    return result;
+  }
+
+} // anonymous namespace
+
+//=============================================================================
+// class : optional_vector
+//=============================================================================
+
+//-----------------------------------------------------------------------------
+// Constructors
+//-----------------------------------------------------------------------------
+
+TEST_CASE("optional_vector::optional_vector( size_type )","[ctor]")
+{
+  auto sut = bpstd::optional_vector<int>(100u);
+
+  SECTION("Contains 'count' elements")
+  {
+    REQUIRE(sut.size() == 100u);
+  }
+  SECTION("No elements contain values")
+  {
+    REQUIRE(sut.count() == 0u);
+    REQUIRE(sut.find_next() == sut.size());
+  }
+}
+
+TEST_CASE("optional_vector::optional_vector( std::initializer_list<optional<T>> )","[ctor]")
+{
+  auto sut = bpstd::optional_vector<std::string>{
+    std::string{"hello"}, bpstd::nullopt, std::string{"world"}
+  };
+
+  SECTION("Contains each element")
+  {
+    REQUIRE(sut.size() == 3u);
+  }
+  SECTION("Elements with values contain the values")
+  {
+    REQUIRE(sut.value(0u) == "hello");
+    REQUIRE(sut.value(2u) == "world");
+  }
+  SECTION("Elements without values are empty")
+  {
+    REQUIRE_FALSE(sut.has_value(1u));
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Element Access
+//-----------------------------------------------------------------------------
+
+TEST_CASE("optional_vector::value( size_type )","[element access]")
+{
+  auto sut = bpstd::optional_vector<int>{42, bpstd::nullopt};
+
+  SECTION("Element contains a value")
+  {
+    SECTION("Returns the value")
+    {
+      REQUIRE(sut.value(0u) == 42);
+    }
+  }
+  SECTION("Element does not contain a value")
+  {
+    SECTION("Throws bad_optional_access")
+    {
+      REQUIRE_THROWS_AS(sut.value(1u), bpstd::bad_optional_access);
+    }
+  }
+}
+
+TEST_CASE("optional_vector::get( size_type )","[element access]")
+{
+  const auto sut = bpstd::optional_vector<int>{42, bpstd::nullopt};
+
+  SECTION("Element contains a value")
+  {
+    SECTION("Returns an optional containing the value")
+    {
+      REQUIRE(sut.get(0u) == 42);
+    }
+  }
+  SECTION("Element does not contain a value")
+  {
+    SECTION("Returns nullopt")
+    {
+      REQUIRE(sut.get(1u) == bpstd::nullopt);
+    }
+  }
+}
+
+TEST_CASE("optional_vector::values()","[element access]")
+{
+  auto sut = bpstd::optional_vector<int>{1, bpstd::nullopt, 3};
+
+  const auto values = sut.values();
+
+  SECTION("Views every value slot")
+  {
+    REQUIRE(values.size() == 3u);
+  }
+  SECTION("Values are contiguous")
+  {
+    REQUIRE(&values[2] == &values[0] + 2);
+  }
+  SECTION("Empty slots are value-initialized")
+  {
+    REQUIRE(values[1] == 0);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Modifiers
+//-----------------------------------------------------------------------------
+
+TEST_CASE("optional_vector::set( size_type, T&& )","[modifiers]")
+{
+  auto sut = bpstd::optional_vector<int>(3u);
+
+  sut.set(1u, 42);
+
+  SECTION("Element contains the value")
+  {
+    REQUIRE(sut.value(1u) == 42);
+  }
+  SECTION("Other elements are unchanged")
+  {
+    REQUIRE(sut.count() == 1u);
+  }
+}
+
+TEST_CASE("optional_vector::reset( size_type )","[modifiers]")
+{
+  auto sut = bpstd::optional_vector<int>{1, 2, 3};
+
+  sut.reset(1u);
+
+  SECTION("Element no longer contains a value")
+  {
+    REQUIRE_FALSE(sut.has_value(1u));
+  }
+  SECTION("Value slot is value-initialized")
+  {
+    REQUIRE(sut.values()[1] == 0);
+  }
+}
+
+TEST_CASE("optional_vector::pop_back()","[modifiers]")
+{
+  auto sut = make_strided(65u, 1u);
+
+  sut.pop_back();
+  sut.push_back(bpstd::nullopt);
+
+  SECTION("Appended element does not inherit the removed value")
+  {
+    REQUIRE_FALSE(sut.has_value(64u));
+  }
+}
+
+TEST_CASE("optional_vector::resize( size_type )","[modifiers]")
+{
+  auto sut = make_strided(200u, 1u);
+
+  SECTION("Shrinking")
+  {
+    sut.resize(70u);
+
+    SECTION("Removes trailing elements")
+    {
+      REQUIRE(sut.size() == 70u);
+      REQUIRE(sut.count() == 70u);
+    }
+
+    SECTION("Growing again adds empty elements")
+    {
+      sut.resize(200u);
+
+      REQUIRE(sut.count() == 70u);
+      REQUIRE(sut.find_next(70u) == sut.size());
+    }
+  }
+  SECTION("Shrinking to a word boundary")
+  {
+    sut.resize(128u);
+    sut.resize(130u);
+
+    REQUIRE(sut.count() == 128u);
+  }
+}
+
+//-----------------------------------------------------------------------------
+// Scanning
+//-----------------------------------------------------------------------------
+
+TEST_CASE("optional_vector::count()","[scanning]")
+{
+  const auto sut = make_strided(1000u, 3u);
+
+  REQUIRE(sut.count() == 334u);
+}
+
+TEST_CASE("optional_vector::find_next( size_type )","[scanning]")
+{
+  const auto sut = make_strided(300u, 100u);
+
+  SECTION("Value is at 'pos'")
+  {
+    REQUIRE(sut.find_next(100u) == 100u);
+  }
+  SECTION("Value is in a later word")
+  {
+    REQUIRE(sut.find_next(101u) == 200u);
+  }
+  SECTION("No value after 'pos'")
+  {
+    REQUIRE(sut.find_next(201u) == sut.size());
+  }
+  SECTION("'pos' is out of range")
+  {
+    REQUIRE(sut.find_next(1000u) == sut.size());
+  }
+}
+
+TEST_CASE("optional_vector::for_each_value( Fn&& )","[scanning]")
+{
+  const auto sut = make_strided(300u, 7u);
+
+  auto indices = std::vector<std::size_t>{};
+  auto sum = 0;
+  sut.for_each_value([&](std::size_t index, const int& value) {
+    indices.push_back(index);
+    sum += value;
+  });
+
+  SECTION("Visits every value")
+  {
+    REQUIRE(indices.size() == sut.count());
+  }
+  SECTION("Visits values in order")
+  {
+    for (auto i = 0u; i < indices.size(); ++i) {
+      REQUIRE(indices[i] == i * 7u);
+    }
+  }
+  SECTION("Passes each value")
+  {
+    auto expected = 0;
+    for (auto i = 0; i < 300; i += 7) {
+      expected += i;
+    }
+    REQUIRE(sum == expected);
+  }
+}
@@ -0,0 +1,208 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/record_reader.hpp>
+
+#include <catch2/catch.hpp>
+
+#if BPSTD_HAS_RECORD_READER
+
+#include <string>       // std::string
+#include <system_error> // std::system_error
+#include <vector>       // std::vector
+#include <unistd.h>     // ::pipe, ::write, ::close
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  /// \brief A pipe that has been filled with the given contents, and closed
+  ///        for writing
+  ///
+  /// The contents must fit in the pipe's buffer.
+  class filled_pipe
+  {
+  public:
+    explicit filled_pipe(const std::string& contents)
+    {
+      int fds[2];
+      REQUIRE(::pipe(fds) == 0);
+      m_fd = fds[0];
+
+      if (!contents.empty()) {
+        const auto written = ::write(fds[1], contents.data(), contents.size());
+        REQUIRE(written == static_cast<::ssize_t>(contents.size()));
+      }
+      ::close(fds[1]);
+    }
+
+    ~filled_pipe()
+    {
+      ::close(m_fd);
+    }
+
+    int fd() const noexcept { return m_fd; }
+
+  private:
+    int m_fd;
+  };
+
+  /// \brief Reads every record from \p reader
+  std::vector<std::string> read_all(bpstd::record_reader& reader)
+  {
+    auto result = std::vector<std::string>{};
+    while (auto record = reader.next()) {
+      result.emplace_back(record->data(), record->size());
+    }
+    return result;
+  }
+
+} // namespace <anonymous>
+
+TEST_CASE("record_reader::next()", "[reading]")
+{
+  using records = std::vector<std::string>;
+
+  SECTION("Input is empty")
+  {
+    const auto input = filled_pipe{""};
+    auto sut = bpstd::record_reader{input.fd()};
+
+    SECTION("Has no records")
+    {
+      REQUIRE_FALSE(sut.next().has_value());
+    }
+  }
+  SECTION("Input ends with a delimiter")
+  {
+    const auto input = filled_pipe{"hello\nworld\n"};
+    auto sut = bpstd::record_reader{input.fd()};
+
+    SECTION("Yields each record without its delimiter")
+    {
+      REQUIRE(read_all(sut) == records{"hello", "world"});
+    }
+  }
+  SECTION("Input does not end with a delimiter")
+  {
+    const auto input = filled_pipe{"hello\nworld"};
+    auto sut = bpstd::record_reader{input.fd()};
+
+    SECTION("Yields the final record")
+    {
+      REQUIRE(read_all(sut) == records{"hello", "world"});
+    }
+  }
+  SECTION("Input contains empty records")
+  {
+    const auto input = filled_pipe{"\nhello\n\n"};
+    auto sut = bpstd::record_reader{input.fd()};
+
+    SECTION("Yields the empty records")
+    {
+      REQUIRE(read_all(sut) == records{"", "hello", ""});
+    }
+  }
+  SECTION("Delimiter is not a newline")
+  {
+    const auto input = filled_pipe{"a,b\n,c"};
+    auto sut = bpstd::record_reader{input.fd(), ','};
+
+    SECTION("Splits on the delimiter")
+    {
+      REQUIRE(read_all(sut) == records{"a", "b\n", "c"});
+    }
+  }
+  SECTION("Records cross the end of the buffer")
+  {
+    const auto input = filled_pipe{"abc\ndefg\nhi\njk"};
+    auto sut = bpstd::record_reader{input.fd(), '\n', 6u};
+
+    SECTION("Yields each record whole")
+    {
+      REQUIRE(read_all(sut) == records{"abc", "defg", "hi", "jk"});
+    }
+    SECTION("Does not grow the buffer")
+    {
+      read_all(sut);
+
+      REQUIRE(sut.capacity() == 6u);
+    }
+  }
+  SECTION("Record is larger than the buffer")
+  {
+    const auto large = std::string(100u, 'x');
+    const auto input = filled_pipe{"a\n" + large + "\nb"};
+    auto sut = bpstd::record_reader{input.fd(), '\n', 4u};
+
+    SECTION("Yields each record whole")
+    {
+      REQUIRE(read_all(sut) == records{"a", large, "b"});
+    }
+    SECTION("Grows the buffer")
+    {
+      read_all(sut);
+
+      REQUIRE(sut.capacity() > large.size());
+    }
+  }
+  SECTION("Reading fails")
+  {
+    auto sut = bpstd::record_reader{-1};
+
+    SECTION("Throws std::system_error")
+    {
+      REQUIRE_THROWS_AS(sut.next(), std::system_error);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Observers
+//------------------------------------------------------------------------------
+
+TEST_CASE("record_reader::record_reader( int, char, size_type )", "[ctor]")
+{
+  const auto sut = bpstd::record_reader{3, ';', 128u};
+
+  SECTION("Reads from the file descriptor")
+  {
+    REQUIRE(sut.fd() == 3);
+  }
+  SECTION("Splits on the delimiter")
+  {
+    REQUIRE(sut.delimiter() == ';');
+  }
+  SECTION("Buffers the capacity")
+  {
+    REQUIRE(sut.capacity() == 128u);
+  }
+}
+
+#endif /* BPSTD_HAS_RECORD_READER */
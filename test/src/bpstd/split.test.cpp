@@ -0,0 +1,232 @@
+/*
+  The MIT License (MIT)
+
+  Copyright (c) 2020 Matthew Rodusek All rights reserved.
+
+  Permission is hereby granted, free of charge, to any person obtaining a copy
+  of this software and associated documentation files (the "Software"), to deal
+  in the Software without restriction, including without limitation the rights
+  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+  copies of the Software, and to permit persons to whom the Software is
+  furnished to do so, subject to the following conditions:
+
+  The above copyright notice and this permission notice shall be included in
+  all copies or substantial portions of the Software.
+
+  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+  SOFTWARE.
+*/
+
+#include <bpstd/split.hpp>
+
+#include <string>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+// MSVC 2015 seems to emit an error that __forceinline'd functions may not be
+// __forceinline'd at the *end of the translation unit* using it, for some
+// stupid reason.
+#if defined(_MSC_VER)
+# pragma warning(disable:4714)
+#endif
+
+namespace {
+
+  using fields = std::vector<std::string>;
+
+  /// \brief Collects each field of \p range into a std::vector
+  template <typename Range>
+  fields collect(const Range& range)
+  {
+    auto result = fields{};
+    for (auto field : range) {
+      result.emplace_back(field.data(), field.size());
+    }
+    return result;
+  }
+
+} // namespace <anonymous>
+
+//----------------------------------------------------------------------------
+// Splitting
+//----------------------------------------------------------------------------
+
+TEST_CASE("split( string_view, char )", "[split]")
+{
+  SECTION("String contains delimiters")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"a,b,c"}, ',');
+
+    SECTION("Produces each field")
+    {
+      REQUIRE( collect(sut) == fields{"a", "b", "c"} );
+    }
+  }
+  SECTION("String contains no delimiters")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{"abc"}, ',');
+
+    SECTION("Produces the whole string")
+    {
+      REQUIRE( collect(sut) == fields{"abc"} );
+    }
+  }
+  SECTION("String is empty")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{}, ',');
+
+    SECTION("Produces a single empty field")
+    {
+      REQUIRE( collect(sut) == fields{""} );
+    }
+  }
+  SECTION("String has adjacent, leading and trailing delimiters")
+  {
+    const auto input = bpstd::string_view{",a,,b,"};
+
+    SECTION("Empty fields are kept")
+    {
+      const auto sut = bpstd::split(input, ',');
+
+      SECTION("Produces the empty fields")
+      {
+        REQUIRE( collect(sut) == fields{"", "a", "", "b", ""} );
+      }
+    }
+    SECTION("Empty fields are skipped")
+    {
+      const auto sut = bpstd::split(input, ',', bpstd::empty_fields::skip);
+
+      SECTION("Produces only the non-empty fields")
+      {
+        REQUIRE( collect(sut) == fields{"a", "b"} );
+      }
+    }
+  }
+  SECTION("String is only delimiters, and empty fields are skipped")
+  {
+    const auto sut = bpstd::split(bpstd::string_view{",,,"}, ',',
+                                  bpstd::empty_fields::skip);
+
+    SECTION("Produces no fields")
+    {
+      REQUIRE( sut.begin() == sut.end() );
+    }
+  }
+  SECTION("Splits are limited")
+  {
+    const auto input = bpstd::string_view{"a,,b,c,"};
+
+    SECTION("Empty fields are kept")
+    {
+      const auto sut = bpstd::split(input, ',', bpstd::empty_fields::keep, 2u);
+
+      SECTION("Produces the remainder as the last field")
+      {
+        REQUIRE( collect(sut) == fields{"a", "", "b,c,"} );
+      }
+    }
+    SECTION("Empty fields are skipped")
+    {
+      const auto sut = bpstd::split(input, ',', bpstd::empty_fields::skip, 1u);
+
+      SECTION("Produces the remainder without leading delimiters")
+      {
+        REQUIRE( collect(sut) == fields{"a", "b,c,"} );
+      }
+    }
+    SECTION("No splits are allowed")
+    {
+      const auto sut = bpstd::split(input, ',', bpstd::empty_fields::keep, 0u);
+
+      SECTION("Produces the whole string")
+      {
+        REQUIRE( collect(sut) == fields{"a,,b,c,"} );
+      }
+    }
+  }
+  SECTION("String is wide")
+  {
+    const auto sut = bpstd::split(bpstd::wstring_view{L"a b"}, L' ');
+    auto it = sut.begin();
+
+    SECTION("Produces each field")
+    {
+      REQUIRE( *it == bpstd::wstring_view{L"a"} );
+      REQUIRE( *++it == bpstd::wstring_view{L"b"} );
+      REQUIRE( ++it == sut.end() );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+
+TEST_CASE("split( string_view, string_view )", "[split]")
+{
+  const auto input = bpstd::string_view{"Accept:  text/html ,x"};
+
+  SECTION("Empty fields are kept")
+  {
+    const auto sut = bpstd::split(input, ": ,");
+
+    SECTION("Splits on any of the delimiters")
+    {
+      REQUIRE( collect(sut) == fields{"Accept", "", "", "text/html", "", "x"} );
+    }
+  }
+  SECTION("Empty fields are skipped")
+  {
+    const auto sut = bpstd::split(input, ": ,", bpstd::empty_fields::skip);
+
+    SECTION("Treats runs of delimiters as one")
+    {
+      REQUIRE( collect(sut) == fields{"Accept", "text/html", "x"} );
+    }
+  }
+  SECTION("Splits are limited")
+  {
+    const auto sut = bpstd::split(input, ": ,", bpstd::empty_fields::skip, 1u);
+
+    SECTION("Produces the remainder as the last field")
+    {
+      REQUIRE( collect(sut) == fields{"Accept", "text/html ,x"} );
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Iteration
+//----------------------------------------------------------------------------
+
+TEST_CASE("split_view::iterator", "[split]")
+{
+  const auto input = bpstd::string_view{"a,b"};
+  const auto sut = bpstd::split(input, ',');
+
+  SECTION("Fields view the source string")
+  {
+    REQUIRE( sut.begin()->data() == input.data() );
+  }
+  SECTION("Post-increment returns the previous field")
+  {
+    auto it = sut.begin();
+    const auto previous = it++;
+
+    REQUIRE( *previous == "a" );
+    REQUIRE( *it == "b" );
+  }
+  SECTION("Iterators to the same field compare equal")
+  {
+    REQUIRE( sut.begin() == sut.begin() );
+  }
+  SECTION("Iterators to different fields compare unequal")
+  {
+    REQUIRE( sut.begin() != ++sut.begin() );
+  }
+}
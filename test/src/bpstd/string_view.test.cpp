@@ -26,6 +26,10 @@
 
 #include <string>
 #include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <memory>
 
 #include <catch2/catch.hpp>
 
@@ -537,6 +541,74 @@ TEST_CASE("string_view::find", "[operations]")
       }
     }
   }
+  SECTION("Long string view")
+  {
+    auto str = std::string(1024u, 'a');
+    str.replace(700u, 6u, "needle");
+    str.replace(900u, 6u, "needle");
+    const auto sut = bpstd::string_view{str};
+
+    SECTION("argument in string, offset at 0")
+    {
+      const auto result = sut.find("needle");
+      SECTION("Returns position of first occurrence")
+      {
+        REQUIRE( result == 700u );
+      }
+    }
+    SECTION("argument in string, offset past first occurrence")
+    {
+      const auto result = sut.find("needle", 701u);
+      SECTION("Returns position of next occurrence")
+      {
+        REQUIRE( result == 900u );
+      }
+    }
+    SECTION("argument is repetitive")
+    {
+      const auto result = sut.find("aaaan");
+      SECTION("Returns position")
+      {
+        REQUIRE( result == 696u );
+      }
+    }
+    SECTION("argument not in string")
+    {
+      const auto result = sut.find("needles");
+      SECTION("Returns npos")
+      {
+        REQUIRE( result == bpstd::string_view::npos );
+      }
+    }
+    SECTION("Matches std::string::find for every needle")
+    {
+      for (auto i = 0u; i < str.size(); i += 37u) {
+        for (auto len = 1u; len < 12u && (i + len) <= str.size(); ++len) {
+          const auto needle = str.substr(i, len);
+          REQUIRE( sut.find(needle) == str.find(needle) );
+        }
+      }
+    }
+  }
+  SECTION("Long string view ending in a run of the first needle character")
+  {
+    // The switch to the Horspool search must not happen once fewer than a
+    // needle's worth of characters remain
+    const auto size = 256u;
+    const auto buffer = std::unique_ptr<char[]>{new char[size]};
+    std::fill(buffer.get(), buffer.get() + 173u, 'x');
+    std::fill(buffer.get() + 173u, buffer.get() + size, 'a');
+    const auto sut = bpstd::string_view{buffer.get(), size};
+
+    SECTION("argument not in string")
+    {
+      const auto result = sut.find("aaab");
+      SECTION("Returns npos")
+      {
+        REQUIRE( result == bpstd::string_view::npos );
+      }
+    }
+  }
 }
 
 TEST_CASE("string_view::rfind", "[operations]")
@@ -630,6 +702,48 @@ TEST_CASE("string_view::rfind", "[operations]")
       }
     }
   }
+  SECTION("Long string view")
+  {
+    auto str = std::string(1024u, 'a');
+    str.replace(100u, 6u, "needle");
+    str.replace(700u, 6u, "needle");
+    const auto sut = bpstd::string_view{str};
+
+    SECTION("argument in string, offset at end")
+    {
+      const auto result = sut.rfind("needle");
+      SECTION("Returns position of last occurrence")
+      {
+        REQUIRE( result == 700u );
+      }
+    }
+    SECTION("argument in string, offset before last occurrence")
+    {
+      const auto result = sut.rfind("needle", 699u);
+      SECTION("Returns position of previous occurrence")
+      {
+        REQUIRE( result == 100u );
+      }
+    }
+    SECTION("argument not in string")
+    {
+      const auto result = sut.rfind("needles");
+      SECTION("Returns npos")
+      {
+        REQUIRE( result == bpstd::string_view::npos );
+      }
+    }
+    SECTION("Matches std::string::rfind for every needle")
+    {
+      for (auto i = 0u; i < str.size(); i += 37u) {
+        for (auto len = 1u; len < 12u && (i + len) <= str.size(); ++len) {
+          const auto needle = str.substr(i, len);
+          REQUIRE( sut.rfind(needle) == str.rfind(needle) );
+          REQUIRE( sut.rfind(needle, i) == str.rfind(needle, i) );
+        }
+      }
+    }
+  }
 }
 
 TEST_CASE("string_view::find_first_of", "[operations]")
@@ -740,6 +854,44 @@ TEST_CASE("string_view::find_first_of", "[operations]")
       }
     }
   }
+
+  SECTION("Long string view")
+  {
+    auto str = std::string{};
+    for (auto i = 0u; i < 1000u; ++i) {
+      str += "abc de,fg\th;ij\xe9kl=mn\n"[(i * 7u) % 21u];
+    }
+    const auto sut = bpstd::string_view{str};
+    const char* const sets[] = {
+      "", " ", " \t\r\n", ",;:=", "abcdefghijklmn", "\xe9",
+      "abcdefghijklmn ,;=\t\n", "\x01\x11!1AQaq\x81\x91\xa1\xb1\xc1\xe9"
+    };
+
+    SECTION("Matches std::string::find_first_of")
+    {
+      for (const auto* set : sets) {
+        for (auto pos = 0u; pos <= str.size() + 1u; pos += 13u) {
+          REQUIRE( sut.find_first_of(set, pos) == str.find_first_of(set, pos) );
+        }
+        REQUIRE( sut.find_first_of(set) == str.find_first_of(set) );
+      }
+    }
+  }
+
+  SECTION("Long wide string view")
+  {
+    auto str = std::wstring(300u, L'a');
+    str[200] = L'\x3a9';
+    str[250] = L' ';
+    const auto sut = bpstd::wstring_view{str};
+
+    SECTION("Matches std::wstring::find_first_of")
+    {
+      REQUIRE( sut.find_first_of(L"a") == str.find_first_of(L"a") );
+      REQUIRE( sut.find_first_of(L" \x3a9") == str.find_first_of(L" \x3a9") );
+      REQUIRE( sut.find_first_of(L"\x3a9", 100u) == str.find_first_of(L"\x3a9", 100u) );
+    }
+  }
 }
 
 TEST_CASE("string_view::find_first_not_of", "[operations]")
@@ -850,6 +1002,44 @@ TEST_CASE("string_view::find_first_not_of", "[operations]")
       }
     }
   }
+
+  SECTION("Long string view")
+  {
+    auto str = std::string{};
+    for (auto i = 0u; i < 1000u; ++i) {
+      str += "abc de,fg\th;ij\xe9kl=mn\n"[(i * 7u) % 21u];
+    }
+    const auto sut = bpstd::string_view{str};
+    const char* const sets[] = {
+      "", " ", " \t\r\n", ",;:=", "abcdefghijklmn", "\xe9",
+      "abcdefghijklmn ,;=\t\n", "\x01\x11!1AQaq\x81\x91\xa1\xb1\xc1\xe9"
+    };
+
+    SECTION("Matches std::string::find_first_not_of")
+    {
+      for (const auto* set : sets) {
+        for (auto pos = 0u; pos <= str.size() + 1u; pos += 13u) {
+          REQUIRE( sut.find_first_not_of(set, pos) == str.find_first_not_of(set, pos) );
+        }
+        REQUIRE( sut.find_first_not_of(set) == str.find_first_not_of(set) );
+      }
+    }
+  }
+
+  SECTION("Long wide string view")
+  {
+    auto str = std::wstring(300u, L'a');
+    str[200] = L'\x3a9';
+    str[250] = L' ';
+    const auto sut = bpstd::wstring_view{str};
+
+    SECTION("Matches std::wstring::find_first_not_of")
+    {
+      REQUIRE( sut.find_first_not_of(L"a") == str.find_first_not_of(L"a") );
+      REQUIRE( sut.find_first_not_of(L" \x3a9") == str.find_first_not_of(L" \x3a9") );
+      REQUIRE( sut.find_first_not_of(L"\x3a9", 100u) == str.find_first_not_of(L"\x3a9", 100u) );
+    }
+  }
 }
 
 TEST_CASE("string_view::find_last_of", "[operations]")
@@ -960,6 +1150,44 @@ TEST_CASE("string_view::find_last_of", "[operations]")
       }
     }
   }
+
+  SECTION("Long string view")
+  {
+    auto str = std::string{};
+    for (auto i = 0u; i < 1000u; ++i) {
+      str += "abc de,fg\th;ij\xe9kl=mn\n"[(i * 7u) % 21u];
+    }
+    const auto sut = bpstd::string_view{str};
+    const char* const sets[] = {
+      "", " ", " \t\r\n", ",;:=", "abcdefghijklmn", "\xe9",
+      "abcdefghijklmn ,;=\t\n", "\x01\x11!1AQaq\x81\x91\xa1\xb1\xc1\xe9"
+    };
+
+    SECTION("Matches std::string::find_last_of")
+    {
+      for (const auto* set : sets) {
+        for (auto pos = 0u; pos <= str.size() + 1u; pos += 13u) {
+          REQUIRE( sut.find_last_of(set, pos) == str.find_last_of(set, pos) );
+        }
+        REQUIRE( sut.find_last_of(set) == str.find_last_of(set) );
+      }
+    }
+  }
+
+  SECTION("Long wide string view")
+  {
+    auto str = std::wstring(300u, L'a');
+    str[200] = L'\x3a9';
+    str[250] = L' ';
+    const auto sut = bpstd::wstring_view{str};
+
+    SECTION("Matches std::wstring::find_last_of")
+    {
+      REQUIRE( sut.find_last_of(L"a") == str.find_last_of(L"a") );
+      REQUIRE( sut.find_last_of(L" \x3a9") == str.find_last_of(L" \x3a9") );
+      REQUIRE( sut.find_last_of(L"\x3a9", 100u) == str.find_last_of(L"\x3a9", 100u) );
+    }
+  }
 }
 
 TEST_CASE("string_view::find_last_not_of", "[operations]")
@@ -1070,6 +1298,44 @@ TEST_CASE("string_view::find_last_not_of", "[operations]")
       }
     }
   }
+
+  SECTION("Long string view")
+  {
+    auto str = std::string{};
+    for (auto i = 0u; i < 1000u; ++i) {
+      str += "abc de,fg\th;ij\xe9kl=mn\n"[(i * 7u) % 21u];
+    }
+    const auto sut = bpstd::string_view{str};
+    const char* const sets[] = {
+      "", " ", " \t\r\n", ",;:=", "abcdefghijklmn", "\xe9",
+      "abcdefghijklmn ,;=\t\n", "\x01\x11!1AQaq\x81\x91\xa1\xb1\xc1\xe9"
+    };
+
+    SECTION("Matches std::string::find_last_not_of")
+    {
+      for (const auto* set : sets) {
+        for (auto pos = 0u; pos <= str.size() + 1u; pos += 13u) {
+          REQUIRE( sut.find_last_not_of(set, pos) == str.find_last_not_of(set, pos) );
+        }
+        REQUIRE( sut.find_last_not_of(set) == str.find_last_not_of(set) );
+      }
+    }
+  }
+
+  SECTION("Long wide string view")
+  {
+    auto str = std::wstring(300u, L'a');
+    str[200] = L'\x3a9';
+    str[250] = L' ';
+    const auto sut = bpstd::wstring_view{str};
+
+    SECTION("Matches std::wstring::find_last_not_of")
+    {
+      REQUIRE( sut.find_last_not_of(L"a") == str.find_last_not_of(L"a") );
+      REQUIRE( sut.find_last_not_of(L" \x3a9") == str.find_last_not_of(L" \x3a9") );
+      REQUIRE( sut.find_last_not_of(L"\x3a9", 100u) == str.find_last_not_of(L"\x3a9", 100u) );
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -1498,3 +1764,72 @@ TEST_CASE("string_view::operator>=(...)","[comparison]")
     }
   }
 }
+
+//----------------------------------------------------------------------------
+// Hashing
+//----------------------------------------------------------------------------
+
+#if __cplusplus >= 201402L
+static_assert(
+  bpstd::basic_string_view_hash<char>{}(bpstd::string_view{"hello world", 11}) ==
+  bpstd::basic_string_view_hash<char>{}(bpstd::string_view{"hello world!", 11}),
+  "basic_string_view_hash must be usable in constant expressions"
+);
+#endif
+
+TEST_CASE("std::hash<string_view>", "[hash]")
+{
+  const auto hash = std::hash<bpstd::string_view>{};
+
+  SECTION("Views of equal characters in different buffers")
+  {
+    const auto str = std::string{"hello world hello world"};
+    const auto lhs = bpstd::string_view{str}.substr(0, 11);
+    const auto rhs = bpstd::string_view{str}.substr(12, 11);
+
+    SECTION("Hash to the same value")
+    {
+      REQUIRE( hash(lhs) == hash(rhs) );
+    }
+  }
+  SECTION("Views of different characters")
+  {
+    SECTION("Hash to distinct values for every length")
+    {
+      const auto str = std::string(200u, 'x');
+      auto hashes = std::unordered_set<std::size_t>{};
+      for (auto i = 0u; i <= str.size(); ++i) {
+        hashes.insert(hash(bpstd::string_view{str}.substr(0, i)));
+      }
+      REQUIRE( hashes.size() == (str.size() + 1u) );
+    }
+    SECTION("Hash to distinct values for single character changes")
+    {
+      auto str = std::string(64u, 'x');
+      const auto original = hash(str);
+      for (auto i = 0u; i < str.size(); ++i) {
+        str[i] = 'y';
+        REQUIRE( hash(str) != original );
+        str[i] = 'x';
+      }
+    }
+  }
+  SECTION("Is usable as an unordered_map key")
+  {
+    auto map = std::unordered_map<bpstd::string_view,int>{};
+    map["hello"] = 1;
+    map["world"] = 2;
+
+    const auto str = std::string{"hello"};
+    REQUIRE( map.at(bpstd::string_view{str}) == 1 );
+  }
+  SECTION("Is defined for every string_view alias")
+  {
+    REQUIRE( std::hash<bpstd::wstring_view>{}(L"hello") ==
+             std::hash<bpstd::wstring_view>{}(std::wstring{L"hello"}) );
+    REQUIRE( std::hash<bpstd::u16string_view>{}(u"hello") ==
+             std::hash<bpstd::u16string_view>{}(std::u16string{u"hello"}) );
+    REQUIRE( std::hash<bpstd::u32string_view>{}(U"hello") ==
+             std::hash<bpstd::u32string_view>{}(std::u32string{U"hello"}) );
+  }
+}
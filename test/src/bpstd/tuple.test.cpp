@@ -72,6 +72,7 @@ namespace {
 
   bool equal(int x, int y) { return x == y; }
   bool nothrow_equal(int x, int y) { return x == y; }
+  void increment(int& x) { ++x; }
 
   struct test_object
   {
@@ -253,6 +254,17 @@ TEST_CASE("apply(...)", "[functional]")
       }
     }
   }
+  SECTION("Tuple is an lvalue")
+  {
+    auto tuple = std::make_tuple(41);
+
+    SECTION("Elements are passed by reference")
+    {
+      bpstd::apply(&::increment, tuple);
+
+      REQUIRE(std::get<0>(tuple) == 42);
+    }
+  }
 }
 
 TEST_CASE("make_from_tuple<T>(...)", "[functional]")
@@ -85,6 +85,10 @@ static_assert(
   bpstd::is_invocable_r<int, decltype(&::invocable_test), int>::value,
   "invocable_test returns a 'bool', which is convertible to 'int'"
 );
+static_assert(
+  bpstd::is_invocable_r<void, decltype(&::invocable_test), int>::value,
+  "invocable_test returns a 'bool', which may be discarded as 'void'"
+);
 
 // C++11 and C++14 don't encode 'noexcept' in the type, so we can't test for
 // noexcept status on function or member function pointers.. So test with a
@@ -25,6 +25,8 @@
 #include <bpstd/utility.hpp>
 
 #include <catch2/catch.hpp>
+#include <cstddef>     // std::size_t
+#include <type_traits> // std::is_same
 
 // MSVC 2015 seems to emit an error that __forceinline'd functions may not be
 // __forceinline'd at the *end of the translation unit* using it, for some
@@ -33,6 +35,63 @@
 # pragma warning(disable:4714)
 #endif
 
+//------------------------------------------------------------------------------
+// Integer Sequences
+//------------------------------------------------------------------------------
+
+static_assert(
+  std::is_same<bpstd::make_index_sequence<0>,bpstd::index_sequence<>>::value,
+  "make_index_sequence<0> must be empty"
+);
+static_assert(
+  std::is_same<bpstd::make_index_sequence<5>,bpstd::index_sequence<0,1,2,3,4>>::value,
+  "make_index_sequence<5> must count from 0 to 4"
+);
+static_assert(
+  std::is_same<bpstd::make_integer_sequence<int,3>,bpstd::integer_sequence<int,0,1,2>>::value,
+  "make_integer_sequence must produce the requested integer type"
+);
+static_assert(
+  std::is_same<bpstd::index_sequence_for<int,float>,bpstd::index_sequence<0,1>>::value,
+  "index_sequence_for must have one index per type"
+);
+static_assert(
+  bpstd::make_index_sequence<4096>::size() == 4096u,
+  "Large sequences must not exceed the instantiation depth"
+);
+
+// The portable construction is only used by compilers without an intrinsic,
+// so it is checked directly
+static_assert(
+  std::is_same<
+    bpstd::detail::make_integer_sequence_impl<std::size_t,0>::type,
+    bpstd::index_sequence<>
+  >::value,
+  "The portable construction of an empty sequence must be empty"
+);
+static_assert(
+  std::is_same<
+    bpstd::detail::make_integer_sequence_impl<std::size_t,7>::type,
+    bpstd::make_index_sequence<7>
+  >::value,
+  "The portable construction must agree for odd sizes"
+);
+static_assert(
+  std::is_same<
+    bpstd::detail::make_integer_sequence_impl<long,8>::type,
+    bpstd::make_integer_sequence<long,8>
+  >::value,
+  "The portable construction must agree for even sizes"
+);
+static_assert(
+  bpstd::detail::make_integer_sequence_impl<std::size_t,4096>::type::size() == 4096u,
+  "The portable construction must not exceed the instantiation depth"
+);
+
+//------------------------------------------------------------------------------
+// Utilities
+//------------------------------------------------------------------------------
+
 TEST_CASE("get<T>(pair&)", "[utility]")
 {
   auto sut = bpstd::pair<int,float>{1,3.14f};
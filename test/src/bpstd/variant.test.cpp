@@ -38,6 +38,9 @@
 #include <memory>    // std::unique_ptr
 #include <stdexcept> // std::runtime_error
 #include <cassert>   // assert
+#include <cstdint>   // std::int32_t, std::int64_t, std::uint16_t
+#include <vector>    // std::vector
+#include <type_traits> // std::is_same
 
 // MSVC 2015 seems to emit an error that __forceinline'd functions may not be
 // __forceinline'd at the *end of the translation unit* using it, for some
@@ -56,6 +59,27 @@ static_assert(
   "Variant containing non-trivially destructible types must not be trivially destructible"
 );
 
+static_assert(
+  sizeof(bpstd::variant<std::int32_t,float,std::uint16_t>) == 8u,
+  "Variant of 4-byte alternatives must pack the index into the padding"
+);
+static_assert(
+  sizeof(bpstd::variant<char,bool>) == 2u,
+  "Variant of 1-byte alternatives must only require a 1-byte index"
+);
+static_assert(
+  sizeof(bpstd::variant<double,std::int64_t>) == 16u,
+  "Variant of 8-byte alternatives must only require a 1-byte index"
+);
+static_assert(
+  std::is_same<bpstd::detail::variant_index_t<254>,std::uint8_t>::value,
+  "254 alternatives plus the valueless sentinel must fit in a std::uint8_t"
+);
+static_assert(
+  std::is_same<bpstd::detail::variant_index_t<255>,std::uint16_t>::value,
+  "255 alternatives plus the valueless sentinel require a std::uint16_t"
+);
+
 namespace {
   struct throw_on_move
   {
@@ -715,6 +739,31 @@ TEST_CASE("variant::emplace<I>( std::initializer_list<U>, Args&&... )", "[modifi
 
 //-----------------------------------------------------------------------------
 
+TEST_CASE("variant::index()", "[observers]")
+{
+  SECTION("Variant contains value")
+  {
+    auto sut = bpstd::variant<char, bool, std::int32_t>{std::int32_t{42}};
+
+    SECTION("Returns the index of the active alternative")
+    {
+      REQUIRE(sut.index() == 2u);
+    }
+  }
+
+  SECTION("Variant is valueless_by_exception")
+  {
+    auto sut = make_valueless_by_exception();
+
+    SECTION("Returns variant_npos")
+    {
+      REQUIRE(sut.index() == bpstd::variant_npos);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+
 TEST_CASE("variant::swap( variant& )", "[modifiers]")
 {
   using variant_type = bpstd::variant<std::string,bool,::throw_on_move>;
@@ -1246,6 +1295,153 @@ TEST_CASE("visit( Visitor, variant&, variant&&, const variant& )", "[utilities]"
   }
 }
 
+namespace {
+
+template <std::size_t N>
+struct alternative
+{
+  std::size_t value;
+};
+
+template <std::size_t N>
+bool operator==(const alternative<N>& lhs, const alternative<N>& rhs)
+{
+  return lhs.value == rhs.value;
+}
+
+template <std::size_t N>
+bool operator<(const alternative<N>& lhs, const alternative<N>& rhs)
+{
+  return lhs.value < rhs.value;
+}
+
+struct index_visitor
+{
+  template <std::size_t N>
+  std::size_t operator()(const alternative<N>& a) const
+  {
+    return a.value == N ? N : static_cast<std::size_t>(-1);
+  }
+};
+
+template <typename IndexSequence>
+struct large_variant;
+
+template <std::size_t...Idxs>
+struct large_variant<bpstd::index_sequence<Idxs...>>
+{
+  using type = bpstd::variant<alternative<Idxs>...>;
+
+  // Makes one variant for every alternative, in index order
+  static std::vector<type> make_all()
+  {
+    return { type{bpstd::in_place_index_t<Idxs>{}, alternative<Idxs>{Idxs}}... };
+  }
+};
+
+} // namespace <anonymous>
+
+TEST_CASE("visit( Visitor, variant& ) with many alternatives", "[utilities]")
+{
+  using variant_type = large_variant<bpstd::make_index_sequence<64>>::type;
+
+  auto suts = large_variant<bpstd::make_index_sequence<64>>::make_all();
+
+  SECTION("Visits the active element of every alternative")
+  {
+    for (auto i = 0u; i < suts.size(); ++i) {
+      REQUIRE(bpstd::visit(::index_visitor{}, suts[i]) == i);
+    }
+  }
+
+  SECTION("Copy-constructs every alternative")
+  {
+    for (auto i = 0u; i < suts.size(); ++i) {
+      const auto copy = variant_type{suts[i]};
+
+      REQUIRE(copy.index() == i);
+      REQUIRE(copy == suts[i]);
+    }
+  }
+
+  SECTION("Move-assigns across alternatives")
+  {
+    auto sut = variant_type{};
+    for (auto i = suts.size(); i > 0u; --i) {
+      auto copy = suts[i - 1u];
+      sut = bpstd::move(copy);
+
+      REQUIRE(bpstd::visit(::index_visitor{}, sut) == i - 1u);
+    }
+  }
+
+  SECTION("Compares by index, then by value")
+  {
+    REQUIRE(suts[0] < suts[63]);
+    REQUIRE(suts[31] < suts[32]);
+    REQUIRE_FALSE(suts[40] < suts[40]);
+  }
+}
+
+namespace {
+
+struct flat_index_visitor
+{
+  template <std::size_t N0, std::size_t N1>
+  std::size_t operator()(const alternative<N0>&, alternative<N1>&&) const
+  {
+    return (N0 * 100u) + N1;
+  }
+
+  template <std::size_t N0, std::size_t N1, std::size_t N2>
+  std::size_t operator()(alternative<N0>&, const alternative<N1>&, alternative<N2>&) const
+  {
+    return (N0 * 10000u) + (N1 * 100u) + N2;
+  }
+};
+
+} // namespace <anonymous>
+
+TEST_CASE("visit( Visitor, variant&... ) with many alternatives", "[utilities]")
+{
+  auto suts0 = large_variant<bpstd::make_index_sequence<8>>::make_all();
+  auto suts1 = large_variant<bpstd::make_index_sequence<32>>::make_all();
+  auto suts2 = large_variant<bpstd::make_index_sequence<5>>::make_all();
+
+  SECTION("Visits the active elements of every pair of alternatives")
+  {
+    for (auto i = 0u; i < suts0.size(); ++i) {
+      for (auto j = 0u; j < suts1.size(); ++j) {
+        const auto result = bpstd::visit(
+          ::flat_index_visitor{},
+          as_const(suts0[i]),
+          bpstd::move(suts1[j])
+        );
+
+        REQUIRE(result == (i * 100u) + j);
+      }
+    }
+  }
+
+  SECTION("Visits the active elements of every triple of alternatives")
+  {
+    for (auto i = 0u; i < suts0.size(); ++i) {
+      for (auto j = 0u; j < suts2.size(); ++j) {
+        for (auto k = 0u; k < suts0.size(); ++k) {
+          const auto result = bpstd::visit(
+            ::flat_index_visitor{},
+            suts0[i],
+            as_const(suts2[j]),
+            suts0[k]
+          );
+
+          REQUIRE(result == (i * 10000u) + (j * 100u) + k);
+        }
+      }
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 
 TEST_CASE("holds_alternative(variant)", "[utilities]")
@@ -1508,6 +1704,34 @@ TEST_CASE("get<I>(const variant&&)", "[utilities]")
   }
 }
 
+TEST_CASE("get<I>(variant&) with many alternatives", "[utilities]")
+{
+  using variant_type = large_variant<bpstd::make_index_sequence<64>>::type;
+
+  static_assert(
+    std::is_same<bpstd::variant_alternative_t<0,variant_type>,alternative<0>>::value,
+    "variant_alternative_t must select the first alternative"
+  );
+  static_assert(
+    std::is_same<bpstd::variant_alternative_t<63,variant_type>,alternative<63>>::value,
+    "variant_alternative_t must select the last alternative"
+  );
+
+  auto suts = large_variant<bpstd::make_index_sequence<64>>::make_all();
+
+  SECTION("Returns underlying value for active element")
+  {
+    REQUIRE(bpstd::get<7>(suts[7]).value == 7u);
+    REQUIRE(bpstd::get<8>(suts[8]).value == 8u);
+    REQUIRE(bpstd::get<9>(suts[9]).value == 9u);
+    REQUIRE(bpstd::get<63>(bpstd::as_const(suts[63])).value == 63u);
+  }
+  SECTION("Throws exception for inactive element")
+  {
+    REQUIRE_THROWS_AS(bpstd::get<63>(suts[62]), bpstd::bad_variant_access);
+  }
+}
+
 //------------------------------------------------------------------------------
 
 TEST_CASE("operator==(const variant&, const variant&)", "[comparison]")